@@ -0,0 +1,231 @@
+// src/batch/main.cpp
+// Headless bot-vs-bot match runner. Plays complete matches with no window,
+// spread over every core, and reports throughput and per-difficulty results.
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/bot_planner.h"
+#include "core/game_state.h"
+#include "core/profiler.h"
+#include "core/random.h"
+#include "core/simulation.h"
+#include "core/work_stealing_pool.h"
+
+using namespace tankduel;
+
+namespace {
+
+constexpr int DEFAULT_MATCHES = 1000;
+constexpr int DEFAULT_MAX_TURNS = 200;
+constexpr std::uint32_t DEFAULT_SEED = 1;
+constexpr int DIFFICULTY_COUNT = 3;
+
+const char* difficultyName(Difficulty difficulty) {
+    switch (difficulty) {
+        case Difficulty::Easy: return "Easy";
+        case Difficulty::Medium: return "Medium";
+        case Difficulty::Hard: return "Hard";
+    }
+    return "Medium";
+}
+
+struct BatchOptions {
+    int matches{DEFAULT_MATCHES};
+    unsigned threads{std::max(1u, std::thread::hardware_concurrency())};
+    std::uint32_t seed{DEFAULT_SEED};
+    int tickRate{DEFAULT_TICK_RATE};
+    int maxTurns{DEFAULT_MAX_TURNS};
+    std::string tracePath;
+    bool asyncBots{false};  // plan shots on BotPlanner threads, as the game does
+    bool slicedBots{false}; // plan shots as time-sliced ShotSearches, as single-core games do
+    int rolloutSamples{0};  // > 0: bots pick ammo by full-physics rollouts
+};
+
+struct MatchResult {
+    Difficulty player1{};
+    Difficulty player2{};
+    int winner{0};  // 0 = draw (turn limit reached)
+    int turns{0};
+    std::uint64_t ticks{0};
+};
+
+int turnsPlayed(const GameState& state) {
+    return state.player1.shotsFired + state.player2.shotsFired;
+}
+
+// Mixes the base seed with the match index so every match is reproducible
+// regardless of which worker ends up running it.
+std::uint32_t matchSeed(std::uint32_t base, int index) {
+    std::uint32_t x = base ^ (static_cast<std::uint32_t>(index) * 0x9E3779B9u);
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x;
+}
+
+MatchResult playMatch(const BatchOptions& options, int index) {
+    MatchResult result;
+    result.player1 = static_cast<Difficulty>(index % DIFFICULTY_COUNT);
+    result.player2 = static_cast<Difficulty>((index / DIFFICULTY_COUNT) % DIFFICULTY_COUNT);
+
+    seedRng(matchSeed(options.seed, index));
+
+    GameState state;
+    state.player1.id = 1;
+    state.player1.facingRight = true;
+    state.player2.id = 2;
+    state.player2.facingRight = false;
+    state.gameMode = GameMode::OnePlayer;
+    state.playMode = PlayMode::TurnBased;
+    state.difficulty = result.player2;
+    state.currentScreen = GameScreen::Playing;
+    resetMatch(state);
+    state.player1Bot.enabled = true;
+    state.player1Bot.difficulty = result.player1;
+
+    std::unique_ptr<BotPlanner> planners[2];
+    if (options.asyncBots) {
+        planners[0] = std::make_unique<BotPlanner>();
+        planners[1] = std::make_unique<BotPlanner>();
+        state.player1Bot.planner = planners[0].get();
+        state.player2Bot.planner = planners[1].get();
+    }
+    state.player1Bot.rolloutSamples = options.rolloutSamples;
+    state.player2Bot.rolloutSamples = options.rolloutSamples;
+    ShotSearch searches[2];
+    if (options.slicedBots) {
+        state.player1Bot.search = &searches[0];
+        state.player2Bot.search = &searches[1];
+    }
+
+    const InputState noInput{};
+    const float dt = 1.0f / static_cast<float>(options.tickRate);
+    while (!state.matchOver && turnsPlayed(state) < options.maxTurns) {
+        stepSimulation(state, noInput, dt);
+        ++result.ticks;
+    }
+
+    result.winner = state.matchOver ? state.winner : 0;
+    result.turns = turnsPlayed(state);
+    return result;
+}
+
+void printUsage(const char* program) {
+    std::printf("Usage: %s [--matches N] [--threads N] [--seed N] [--tick-rate HZ] [--max-turns N] [--trace FILE] [--async-bots | --sliced-bots] [--rollout-bots SAMPLES]\n", program);
+}
+
+bool parseOptions(int argc, char** argv, BatchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--matches" && i + 1 < argc) {
+            options.matches = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            options.tickRate = std::clamp(std::atoi(argv[++i]), MIN_TICK_RATE, MAX_TICK_RATE);
+        } else if (arg == "--max-turns" && i + 1 < argc) {
+            options.maxTurns = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--trace" && i + 1 < argc) {
+            options.tracePath = argv[++i];
+        } else if (arg == "--async-bots") {
+            options.asyncBots = true;
+        } else if (arg == "--sliced-bots") {
+            options.slicedBots = true;
+        } else if (arg == "--rollout-bots" && i + 1 < argc) {
+            options.rolloutSamples = std::max(1, std::atoi(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct DifficultyStats {
+    int games{0};
+    int wins{0};
+    int losses{0};
+    int draws{0};
+};
+
+void report(const BatchOptions& options, const std::vector<MatchResult>& results, double seconds) {
+    std::array<DifficultyStats, DIFFICULTY_COUNT> stats{};
+    std::uint64_t totalTurns = 0;
+    std::uint64_t totalTicks = 0;
+    int draws = 0;
+
+    for (const MatchResult& result : results) {
+        totalTurns += static_cast<std::uint64_t>(result.turns);
+        totalTicks += result.ticks;
+        if (result.winner == 0) ++draws;
+
+        const std::array<std::pair<Difficulty, int>, 2> sides{{ { result.player1, 1 }, { result.player2, 2 } }};
+        for (const auto& side : sides) {
+            DifficultyStats& entry = stats[static_cast<int>(side.first)];
+            ++entry.games;
+            if (result.winner == 0) {
+                ++entry.draws;
+            } else if (result.winner == side.second) {
+                ++entry.wins;
+            } else {
+                ++entry.losses;
+            }
+        }
+    }
+
+    const double matchCount = static_cast<double>(results.size());
+    std::printf("Matches:            %zu (%d draws)\n", results.size(), draws);
+    std::printf("Threads:            %u\n", options.threads);
+    std::printf("Wall time:          %.3f s\n", seconds);
+    std::printf("Matches/second:     %.1f\n", seconds > 0.0 ? matchCount / seconds : 0.0);
+    std::printf("Sim ticks/second:   %.0f\n", seconds > 0.0 ? static_cast<double>(totalTicks) / seconds : 0.0);
+    std::printf("Avg turns/match:    %.2f\n", static_cast<double>(totalTurns) / matchCount);
+    std::printf("\n%-8s %8s %8s %8s %8s %9s\n", "Bot", "Games", "Wins", "Losses", "Draws", "Win rate");
+    for (int i = 0; i < DIFFICULTY_COUNT; ++i) {
+        const DifficultyStats& entry = stats[i];
+        double winRate = entry.games > 0 ? 100.0 * entry.wins / entry.games : 0.0;
+        std::printf("%-8s %8d %8d %8d %8d %8.1f%%\n", difficultyName(static_cast<Difficulty>(i)),
+                    entry.games, entry.wins, entry.losses, entry.draws, winRate);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BatchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    if (!options.tracePath.empty()) {
+        startProfiling();
+    }
+
+    std::vector<MatchResult> results(static_cast<size_t>(options.matches));
+    auto start = std::chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(options.threads);
+        for (int i = 0; i < options.matches; ++i) {
+            pool.submit([&options, &results, i] { results[static_cast<size_t>(i)] = playMatch(options, i); });
+        }
+        pool.wait();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    report(options, results, std::chrono::duration<double>(end - start).count());
+    if (!options.tracePath.empty() && !writeChromeTrace(options.tracePath)) {
+        std::fprintf(stderr, "Failed to write trace to %s\n", options.tracePath.c_str());
+        return 1;
+    }
+    return 0;
+}
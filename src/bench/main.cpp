@@ -0,0 +1,364 @@
+// src/bench/main.cpp
+// Micro and macro benchmarks for the simulation and rendering hot paths.
+// Every case runs a fixed number of repetitions and reports per-op timing
+// statistics as JSON, so results can be diffed between releases.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core/bot.h"
+#include "core/game_state.h"
+#include "core/random.h"
+#include "core/rollout.h"
+#include "core/shot_solver.h"
+#include "core/simulation.h"
+#include "core/terrain.h"
+#include "core/threat.h"
+
+#if defined(TANK_DUEL_BENCH_RENDER)
+#define SDL_MAIN_HANDLED
+#include <SDL.h>
+
+#include "render/terrain_canvas.h"
+#include "render/text.h"
+#endif
+
+using namespace tankduel;
+
+namespace {
+
+constexpr int DEFAULT_REPETITIONS = 15;
+constexpr double DEFAULT_MIN_REP_MS = 20.0;
+constexpr std::uint32_t BENCH_SEED = 1234;
+
+struct BenchOptions {
+    int repetitions{DEFAULT_REPETITIONS};
+    double minRepMs{DEFAULT_MIN_REP_MS};
+    std::string filter;
+    std::string outputPath;
+};
+
+// setup runs untimed before each repetition; op is one timed operation.
+// A non-zero fixedOps pins the ops per repetition for cases whose state
+// drifts (projectiles land), otherwise it is calibrated to minRepMs.
+struct BenchCase {
+    std::string name;
+    std::function<void()> setup;
+    std::function<void()> op;
+    std::uint64_t fixedOps{0};
+};
+
+struct BenchResult {
+    std::string name;
+    std::uint64_t opsPerRep{0};
+    std::vector<double> nsPerOp;
+};
+
+// Results are folded into this so the optimizer cannot drop the work.
+volatile double benchSink = 0.0;
+
+double runRepetition(const BenchCase& bench, std::uint64_t ops) {
+    if (bench.setup) bench.setup();
+    auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < ops; ++i) {
+        bench.op();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+// Doubles the op count until one repetition takes at least minRepMs.
+std::uint64_t calibrateOps(const BenchCase& bench, double minRepMs) {
+    if (bench.fixedOps > 0) return bench.fixedOps;
+    std::uint64_t ops = 1;
+    while (ops < (1ull << 30)) {
+        if (runRepetition(bench, ops) >= minRepMs * 1.0e6) break;
+        ops *= 2;
+    }
+    return ops;
+}
+
+BenchResult runBench(const BenchCase& bench, const BenchOptions& options) {
+    BenchResult result;
+    result.name = bench.name;
+    result.opsPerRep = calibrateOps(bench, options.minRepMs);
+    runRepetition(bench, result.opsPerRep);  // warm caches
+    for (int rep = 0; rep < options.repetitions; ++rep) {
+        result.nsPerOp.push_back(runRepetition(bench, result.opsPerRep) / static_cast<double>(result.opsPerRep));
+    }
+    return result;
+}
+
+GameState makeMatchState() {
+    seedRng(BENCH_SEED);
+    GameState state;
+    state.player1.id = 1;
+    state.player1.facingRight = true;
+    state.player2.id = 2;
+    state.player2.facingRight = false;
+    state.currentScreen = GameScreen::Playing;
+    resetMatch(state);
+    return state;
+}
+
+// Mortar rounds spread over the sky and climbing, so they stay in flight (and
+// on screen) for the whole 48-tick repetition instead of landing part way.
+void fillProjectiles(GameState& state, int count) {
+    state.projectiles.clear();
+    for (int i = 0; i < count; ++i) {
+        Projectile proj;
+        proj.kind = ProjectileKind::Mortar;
+        proj.owner = 1 + (i & 1);
+        proj.damage = DAMAGE_MORTAR;
+        proj.radius = RADIUS_MORTAR;
+        proj.position = Vec2{ 40.0f + static_cast<float>((i * 37) % (LOGICAL_WIDTH - 80)),
+                              60.0f + static_cast<float>((i * 13) % 60) };
+        proj.velocity = Vec2{ static_cast<float>((i % 21) - 10) * 4.0f, -120.0f };
+        launchProjectile(state, proj);
+    }
+}
+
+std::vector<BenchCase> simulationCases() {
+    std::vector<BenchCase> cases;
+
+    // Shared by reference in the lambdas below; lives for the whole run.
+    static GameState match = makeMatchState();
+    static GameState scratch;
+    static std::vector<int> surface;
+    static std::vector<int> substrate;
+    static std::uint32_t cursor = 0;
+
+    cases.push_back({ "terrainHeightAt", nullptr, [] {
+        cursor = (cursor + 7919) % (LOGICAL_WIDTH * 16);
+        benchSink = benchSink + terrainHeightAt(match.terrain.heights, static_cast<float>(cursor) / 16.0f);
+    } });
+
+    cases.push_back({ "generateTerrain", [] { seedRng(BENCH_SEED); }, [] {
+        generateTerrain(surface, substrate);
+        benchSink = benchSink + surface[surface.size() / 2];
+    } });
+
+    cases.push_back({ "carveCircularCrater", [] { scratch = match; cursor = 0; }, [] {
+        cursor = (cursor + 97) % LOGICAL_WIDTH;
+        carveCircularCrater(scratch, static_cast<float>(cursor), 18.0f, 6.0f);
+    } });
+
+    // Alternating dig and fill keeps the heights from drifting into the clamp
+    cases.push_back({ "deformTerrain", [] { surface = match.terrain.heights; cursor = 0; }, [] {
+        ++cursor;
+        const float depth = (cursor & 1) ? 12.0f : -12.0f;
+        const ColumnRange range = deformTerrain(surface, static_cast<float>((cursor / 2 * 97) % LOGICAL_WIDTH), 24.0f, depth);
+        benchSink = benchSink + range.last;
+    } });
+
+    for (int count : { 10, 100, 1000 }) {
+        cases.push_back({ "updateProjectiles/" + std::to_string(count),
+                          [count] { scratch = match; fillProjectiles(scratch, count); },
+                          [] { updateProjectiles(scratch, 1.0f / 120.0f); }, 48 });
+    }
+
+    for (int count : { 10, 100 }) {
+        cases.push_back({ "predictThreats/" + std::to_string(count),
+                          [count] { scratch = match; fillProjectiles(scratch, count); }, [] {
+            const ThreatReport threats = predictThreats(scratch);
+            benchSink = benchSink + threats.tanks[0].timeToImpact + threats.tanks[1].timeToImpact;
+        } });
+    }
+
+    static const float botPower = calculateOptimalPower(match.player2, match.player1);
+    cases.push_back({ "isTrajectoryBlocked", nullptr, [] {
+        cursor = (cursor + 1) % 64;
+        const float angle = 15.0f + static_cast<float>(cursor);
+        benchSink = benchSink + isTrajectoryBlocked(match, match.player2, match.player1, angle, botPower);
+    } });
+
+    cases.push_back({ "findClearTrajectoryAngle", nullptr, [] {
+        cursor = (cursor + 1) % 40;
+        const float optimal = 30.0f + static_cast<float>(cursor);
+        benchSink = benchSink + findClearTrajectoryAngle(match, match.player2, match.player1, optimal, botPower);
+    } });
+
+    cases.push_back({ "solveShot", nullptr, [] {
+        const ShotSolution shot = solveShot(match, match.player2, match.player1, ProjectileKind::Mortar);
+        benchSink = benchSink + shot.angle;
+    } });
+
+    cases.push_back({ "FiringTable::lookup", [] { match.player2Bot.firingTable.clear(); }, [] {
+        const ShotSolution& shot = match.player2Bot.firingTable.lookup(match, match.player2, match.player1,
+                                                                       ProjectileKind::Mortar);
+        benchSink = benchSink + shot.angle;
+    } });
+
+    cases.push_back({ "cloneSimState", nullptr, [] {
+        cloneSimState(scratch, match);
+        benchSink = benchSink + scratch.player1.hp;
+    } });
+
+    cases.push_back({ "planShotByRollouts/4", [] { match.player2Bot.firingTable.clear(); }, [] {
+        RolloutSettings settings;
+        settings.samples = 4;
+        settings.angleError = 1.5f;
+        settings.powerError = 6.0f;
+        settings.seed = ++cursor;
+        const ShotPlan plan = planShotByRollouts(match, match.player2, match.player1, match.player2Bot.firingTable,
+                                                 ShotGrid{}, settings);
+        benchSink = benchSink + plan.expectedDamage;
+    } });
+
+    return cases;
+}
+
+#if defined(TANK_DUEL_BENCH_RENDER)
+// Offscreen software renderer shared by the render cases.
+struct RenderTarget {
+    SDL_Surface* surface{};
+    SDL_Renderer* renderer{};
+    TerrainCanvas canvas{};
+};
+
+bool createRenderTarget(RenderTarget& target) {
+    target.surface = SDL_CreateRGBSurfaceWithFormat(0, LOGICAL_WIDTH, LOGICAL_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!target.surface) return false;
+    target.renderer = SDL_CreateSoftwareRenderer(target.surface);
+    if (!target.renderer) return false;
+    return createGlyphAtlas(target.renderer) && createTerrainCanvas(target.renderer, target.canvas);
+}
+
+void destroyRenderTarget(RenderTarget& target) {
+    destroyTerrainCanvas(target.canvas);
+    destroyGlyphAtlas();
+    if (target.renderer) SDL_DestroyRenderer(target.renderer);
+    if (target.surface) SDL_FreeSurface(target.surface);
+    target = RenderTarget{};
+}
+
+std::vector<BenchCase> renderCases(RenderTarget& target) {
+    static GameState match = makeMatchState();
+    static RenderTarget* out = nullptr;
+    out = &target;
+
+    std::vector<BenchCase> cases;
+    cases.push_back({ "drawTerrain/full", nullptr, [] {
+        out->canvas.dirty = ColumnRange{ 0, LOGICAL_WIDTH - 1 };
+        drawTerrain(out->renderer, out->canvas, match.terrain);
+    } });
+    cases.push_back({ "drawTerrain/crater", nullptr, [] {
+        out->canvas.dirty = ColumnRange{ LOGICAL_WIDTH / 2 - 20, LOGICAL_WIDTH / 2 + 20 };
+        drawTerrain(out->renderer, out->canvas, match.terrain);
+    } });
+    cases.push_back({ "drawTerrain/clean", nullptr, [] {
+        drawTerrain(out->renderer, out->canvas, match.terrain);
+    } });
+    cases.push_back({ "drawText", nullptr, [] {
+        const SDL_Color color{ 230, 218, 190, 255 };
+        benchSink = benchSink + drawText(out->renderer, 12, 40, "PLAYER 1 - SHOT FIRED 0123456789", color, 2);
+    } });
+    return cases;
+}
+#endif
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    const double index = fraction * static_cast<double>(sorted.size() - 1);
+    const size_t lower = static_cast<size_t>(std::floor(index));
+    const size_t upper = std::min(sorted.size() - 1, lower + 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (index - static_cast<double>(lower));
+}
+
+void writeJson(std::FILE* out, const BenchOptions& options, const std::vector<BenchResult>& results) {
+    std::fprintf(out, "{\n  \"benchmark\": \"tank_duel_bench\",\n");
+    std::fprintf(out, "  \"repetitions\": %d,\n", options.repetitions);
+#if defined(TANK_DUEL_BENCH_RENDER)
+    std::fprintf(out, "  \"render\": true,\n");
+#else
+    std::fprintf(out, "  \"render\": false,\n");
+#endif
+    std::fprintf(out, "  \"results\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& result = results[i];
+        std::vector<double> sorted = result.nsPerOp;
+        std::sort(sorted.begin(), sorted.end());
+        double mean = 0.0;
+        for (double sample : sorted) mean += sample;
+        mean /= static_cast<double>(sorted.size());
+        double variance = 0.0;
+        for (double sample : sorted) variance += (sample - mean) * (sample - mean);
+        const double stddev = sorted.size() > 1 ? std::sqrt(variance / static_cast<double>(sorted.size() - 1)) : 0.0;
+
+        std::fprintf(out, "%s\n    {\"name\": \"%s\", \"ops_per_rep\": %llu, \"ns_per_op\": {", i ? "," : "",
+                     result.name.c_str(), static_cast<unsigned long long>(result.opsPerRep));
+        std::fprintf(out, "\"min\": %.2f, \"median\": %.2f, \"mean\": %.2f, \"stddev\": %.2f, \"p90\": %.2f, \"max\": %.2f}}",
+                     sorted.front(), percentile(sorted, 0.5), mean, stddev, percentile(sorted, 0.9), sorted.back());
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+
+void printUsage(const char* program) {
+    std::printf("Usage: %s [--repetitions N] [--min-rep-ms MS] [--filter TEXT] [--output FILE]\n", program);
+}
+
+bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--repetitions" && i + 1 < argc) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--min-rep-ms" && i + 1 < argc) {
+            options.minRepMs = std::max(0.1, std::atof(argv[++i]));
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            options.outputPath = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<BenchCase> cases = simulationCases();
+#if defined(TANK_DUEL_BENCH_RENDER)
+    RenderTarget target;
+    if (!createRenderTarget(target)) {
+        std::fprintf(stderr, "Failed to create offscreen renderer: %s\n", SDL_GetError());
+        destroyRenderTarget(target);
+        return 1;
+    }
+    for (BenchCase& bench : renderCases(target)) {
+        cases.push_back(std::move(bench));
+    }
+#endif
+
+    std::vector<BenchResult> results;
+    for (const BenchCase& bench : cases) {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos) continue;
+        std::fprintf(stderr, "%s...\n", bench.name.c_str());
+        results.push_back(runBench(bench, options));
+    }
+
+#if defined(TANK_DUEL_BENCH_RENDER)
+    destroyRenderTarget(target);
+#endif
+
+    std::FILE* out = options.outputPath.empty() ? stdout : std::fopen(options.outputPath.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "Failed to open %s\n", options.outputPath.c_str());
+        return 1;
+    }
+    writeJson(out, options, results);
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
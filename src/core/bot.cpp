@@ -0,0 +1,484 @@
+// src/core/bot.cpp
+#include "bot.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "bot_planner.h"
+#include "profiler.h"
+#include "random.h"
+#include "rollout.h"
+#include "simulation.h"
+#include "terrain.h"
+#include "threat.h"
+
+namespace tankduel {
+
+namespace {
+
+// Highest tower top (smallest y) bucketed anywhere in [minX, maxX]
+float highestSceneryTop(const GameState& state, float minX, float maxX) {
+    float top = static_cast<float>(LOGICAL_HEIGHT);
+    const int lastColumn = Broadphase::columnAt(maxX);
+    for (int column = Broadphase::columnAt(minX); column <= lastColumn; ++column) {
+        for (ColliderRef ref : state.broadphase.bucket(column)) {
+            if (ref.kind != ColliderKind::Scenery) break;
+            const SceneryObject& scenery = state.scenery[ref.index];
+            if (scenery.alive) top = std::min(top, scenery.rect.y);
+        }
+    }
+    return top;
+}
+
+struct AimErrorRange {
+    float angle;
+    float power;
+};
+
+AimErrorRange aimErrorRange(Difficulty difficulty) {
+    switch (difficulty) {
+        case Difficulty::Easy:
+            // Target: ~25% hit rate - large errors (about half as good)
+            return { 8.0f, 25.0f };
+        case Difficulty::Medium:
+            // Target: ~65% hit rate - moderate errors
+            return { 1.5f, 6.0f };
+        case Difficulty::Hard:
+            // Target: 99%+ hit rate - nearly perfect aim
+            return { 0.03f, 0.2f };
+    }
+    return { 0.0f, 0.0f };
+}
+
+// Rollouts need the whole state on hand, which a time-sliced search lacks
+bool usesRollouts(const BotBrain& brain) {
+    return brain.rolloutSamples > 0 && !brain.search;
+}
+
+// Draws the turn's ammo (or rollout seed) and the difficulty's aiming error.
+// All of the bot's randomness stays on the simulation thread, so seeded runs
+// repeat.
+void rollBotTurn(const Tank& target, BotBrain& brain) {
+    // Pick the ammo first so the solver flies the shot that will be fired
+    if (usesRollouts(brain)) {
+        brain.rolloutSeed = rng()();
+    } else {
+        brain.targetAmmo = chooseBotAmmo(target);
+    }
+
+    // Add inaccuracy based on difficulty to achieve target hit rates
+    const AimErrorRange range = aimErrorRange(brain.difficulty);
+    brain.angleError = randomFloat(-range.angle, range.angle);
+    brain.powerError = randomFloat(-range.power, range.power);
+}
+
+RolloutSettings botRolloutSettings(const BotBrain& brain) {
+    const AimErrorRange range = aimErrorRange(brain.difficulty);
+    RolloutSettings settings;
+    settings.samples = brain.rolloutSamples;
+    settings.angleError = range.angle;
+    settings.powerError = range.power;
+    settings.seed = brain.rolloutSeed;
+    settings.pool = brain.rolloutPool;
+    return settings;
+}
+
+// Hard searches a four times denser grid when it has a thread to spare.
+// Time-sliced, it keeps refining for as long as the think delay lasts.
+ShotGrid botShotGrid(const BotBrain& brain) {
+    ShotGrid grid;
+    if (brain.difficulty != Difficulty::Hard) return grid;
+    if (brain.planner) {
+        grid.angleSteps *= 2;
+        grid.powerSteps *= 2;
+        grid.refineSteps *= 2;
+    } else if (brain.search) {
+        grid.refineRounds = 8;
+    }
+    return grid;
+}
+
+void applyBotShot(const ShotSolution& shot, BotBrain& brain) {
+    brain.targetAngle = std::clamp(shot.angle + brain.angleError, 0.0f, MAX_TURRET_SWING);
+    brain.targetPower = std::clamp(shot.power + brain.powerError, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+    brain.planReady = true;
+}
+
+// Aims the turn's ammo against the current terrain: in place, on the brain's
+// planner thread or as a time-sliced search. With rollouts the ammo is
+// chosen here too. Runs once per turn, or again if the terrain changes.
+void requestBotShot(const GameState& state, const Tank& bot, const Tank& target, BotBrain& brain) {
+    const ShotGrid grid = botShotGrid(brain);
+    const RolloutSettings rollouts = botRolloutSettings(brain);
+    if (brain.search) {
+        brain.search->begin(state, bot, target, brain.targetAmmo, grid);
+        brain.planReady = false;
+    } else if (brain.planner) {
+        if (!brain.planner->submit(state, bot, target, brain.targetAmmo, grid, usesRollouts(brain) ? &rollouts : nullptr)) {
+            return; // previous request still running; retry next tick
+        }
+        brain.planReady = false;
+    } else if (usesRollouts(brain)) {
+        const ShotPlan plan = planShotByRollouts(state, bot, target, brain.firingTable, grid, rollouts);
+        brain.targetAmmo = plan.kind;
+        applyBotShot(plan.aim, brain);
+    } else {
+        applyBotShot(brain.firingTable.lookup(state, bot, target, brain.targetAmmo, grid), brain);
+    }
+    brain.planRevision = state.terrain.revision();
+    brain.planStale = false;
+}
+
+// Seconds before a predicted crossing that the bot raises its shield: a few
+// ticks of margin, and still late enough that the arc is settled
+constexpr float BOT_SHIELD_LEAD = 0.1f;
+
+// Chance the bot answers a given incoming shot with its shield
+float shieldReactionChance(Difficulty difficulty) {
+    switch (difficulty) {
+        case Difficulty::Easy: return 0.3f;
+        case Difficulty::Medium: return 0.6f;
+        case Difficulty::Hard: return 0.9f;
+    }
+    return 0.0f;
+}
+
+// Raises the shield once the first enemy projectile predicted to cross its
+// radius is within the lead. Each incoming projectile gets one roll against
+// the difficulty's reaction chance, made on the simulation thread.
+void updateBotShield(const GameState& state, Tank& bot, BotBrain& brain) {
+    if (!bot.forceFieldAvailable || bot.forceFieldActive || state.projectiles.empty()) return;
+    // Nothing further out matters yet, so the sweep stops at the lead
+    const IncomingThreat threat = predictThreats(state, BOT_SHIELD_LEAD).against(bot);
+    if (!threat.incoming()) return;
+    if (threat.projectile.slot != brain.shieldThreat.slot ||
+        threat.projectile.generation != brain.shieldThreat.generation) {
+        brain.shieldThreat = threat.projectile;
+        brain.shieldAnswer = randomFloat(0.0f, 1.0f) < shieldReactionChance(brain.difficulty);
+    }
+    if (brain.shieldAnswer) {
+        bot.forceFieldActive = true;
+        bot.forceFieldAvailable = false;
+    }
+}
+
+} // namespace
+
+// Bot AI functions
+float calculateOptimalAngle(const Tank& botTank, const Tank& targetTank, float power) {
+    // Calculate distance and height difference
+    float botX = botTank.rect.x + botTank.rect.w * 0.5f;
+    float targetX = targetTank.rect.x + targetTank.rect.w * 0.5f;
+    float botY = botTank.rect.y + botTank.rect.h * 0.5f;
+    float targetY = targetTank.rect.y + targetTank.rect.h * 0.5f;
+
+    float dx = targetX - botX;
+    float dy = targetY - botY;
+
+    // Improved physics-based calculation for optimal trajectory
+    const float gravity = GRAVITY;
+    float velocity = power;
+    float velocitySq = velocity * velocity;
+
+    // Use proper ballistic formula: angle = 0.5 * arcsin((g * range) / v^2) + height compensation
+    float range = std::abs(dx);
+    if (velocitySq <= 0.0f) return 45.0f;
+
+    // Calculate base angle for flat trajectory
+    float discriminant = velocitySq * velocitySq - gravity * (gravity * range * range + 2.0f * velocitySq * dy);
+
+    if (discriminant < 0.0f) {
+        // Target unreachable with this power, use 45 degrees
+        return 45.0f;
+    }
+
+    // Use the lower angle solution for more direct shot
+    float angle1 = std::atan((velocitySq - std::sqrt(discriminant)) / (gravity * range));
+    float angle2 = std::atan((velocitySq + std::sqrt(discriminant)) / (gravity * range));
+
+    // Choose the angle that's within turret limits
+    float angleDeg1 = angle1 * (180.0f / PI);
+    float angleDeg2 = angle2 * (180.0f / PI);
+
+    float finalAngle = (angleDeg1 >= 0 && angleDeg1 <= MAX_TURRET_SWING) ? angleDeg1 : angleDeg2;
+
+    // If facing left, angles are measured differently
+    if (!botTank.facingRight) {
+        finalAngle = 180.0f - finalAngle;
+    }
+
+    return std::clamp(finalAngle, 5.0f, MAX_TURRET_SWING - 5.0f);
+}
+
+float calculateOptimalPower(const Tank& botTank, const Tank& targetTank) {
+    float botX = botTank.rect.x + botTank.rect.w * 0.5f;
+    float targetX = targetTank.rect.x + targetTank.rect.w * 0.5f;
+    float botY = botTank.rect.y + botTank.rect.h * 0.5f;
+    float targetY = targetTank.rect.y + targetTank.rect.h * 0.5f;
+
+    float dx = targetX - botX;
+    float dy = targetY - botY;
+    float range = std::abs(dx);
+
+    // Physics-based power calculation
+    const float gravity = GRAVITY;
+    const float targetAngle = 45.0f; // Use 45 degrees as reference angle for power calculation
+    const float angleRad = targetAngle * (PI / 180.0f);
+
+    // Calculate required velocity using ballistic formula
+    // v = sqrt(g * range / sin(2 * angle)) for flat trajectory
+    // Add height compensation for dy
+    float basePower = std::sqrt(gravity * range / std::sin(2.0f * angleRad));
+
+    // Height compensation
+    if (dy != 0) {
+        // Adjust power based on height difference
+        float heightFactor = 1.0f + (dy / range) * 0.5f;
+        basePower *= heightFactor;
+    }
+
+    // Ensure power is within reasonable bounds
+    basePower = std::clamp(basePower, MIN_LAUNCH_SPEED * 0.8f, MAX_LAUNCH_SPEED * 1.2f);
+
+    return std::clamp(basePower, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+}
+
+bool isTrajectoryBlocked(const GameState& state, const Tank& shooter, const Tank& target, float angle, float power) {
+    PROFILE_FUNCTION();
+    float shooterX = shooter.rect.x + shooter.rect.w * 0.5f;
+    float shooterY = shooter.rect.y + shooter.rect.h * 0.5f;
+    float targetX = target.rect.x + target.rect.w * 0.5f;
+    float targetY = target.rect.y + target.rect.h * 0.5f;
+
+    // Calculate trajectory using physics simulation
+    float angleRad = angle * (PI / 180.0f);
+    float vx = std::cos(angleRad) * power;
+    float vy = std::sin(angleRad) * power;
+
+    // Adjust direction based on tank facing
+    if (!shooter.facingRight) {
+        vx = -vx;
+    }
+
+    float x = shooterX;
+    float y = shooterY;
+    const float dt = 0.016f; // 60 FPS simulation steps
+    const float gravity = GRAVITY;
+    const float projectileRadius = 3.0f; // Average projectile size
+
+    // Current sky span from the terrain pyramid: while the shot stays inside
+    // it and above its highest ground the terrain sample is skipped, and while
+    // it is also above every tower top there the scenery scan is too
+    float skyStart = 0.0f;
+    float skyEnd = 0.0f;
+    float skyGround = 0.0f;
+    float skyTowers = 0.0f;
+
+    // Simulate trajectory for reasonable time/distance
+    for (int steps = 0; steps < 600; steps++) {
+        // Update position
+        x += vx * dt;
+        y += vy * dt;
+        vy += gravity * dt;
+
+        // Check if we've gone past the target horizontally
+        float distToTarget = std::abs(x - targetX);
+        if (distToTarget < 8.0f) {
+            // Close to target, trajectory is clear
+            return false;
+        }
+
+        // Check if projectile has gone too far or too high/low
+        if (x < -50.0f || x > LOGICAL_WIDTH + 50.0f || y > LOGICAL_HEIGHT + 50.0f) {
+            break;
+        }
+
+        const float bottom = y + projectileRadius;
+        bool inSky = x >= skyStart && x < skyEnd && bottom < skyGround;
+        if (!inSky && state.terrain.pyramid.findSkySpan(x, bottom, skyStart, skyEnd, skyGround)) {
+            skyTowers = highestSceneryTop(state, skyStart - projectileRadius, skyEnd + projectileRadius);
+            inSky = true;
+        }
+        if (inSky && bottom < skyTowers) {
+            continue;
+        }
+
+        // Check terrain collision
+        if (!inSky && bottom >= terrainHeightAt(state.terrain.heights, x)) {
+            // Check if this collision is near the target (acceptable)
+            if (distToTarget < 15.0f) {
+                return false; // Close enough to target
+            }
+            return true; // Blocked by terrain
+        }
+
+        // Check scenery collision (towers)
+        const int lastColumn = Broadphase::columnAt(x + projectileRadius);
+        for (int column = Broadphase::columnAt(x - projectileRadius); column <= lastColumn; ++column) {
+            for (ColliderRef ref : state.broadphase.bucket(column)) {
+                if (ref.kind != ColliderKind::Scenery) break;
+                const SceneryObject& scenery = state.scenery[ref.index];
+                if (!scenery.alive) continue;
+
+                if (x >= scenery.rect.x - projectileRadius &&
+                    x <= scenery.rect.x + scenery.rect.w + projectileRadius &&
+                    y >= scenery.rect.y - projectileRadius &&
+                    y <= scenery.rect.y + scenery.rect.h + projectileRadius) {
+
+                    // Check if collision is near target
+                    if (distToTarget < 15.0f) {
+                        return false; // Close enough to target
+                    }
+                    return true; // Blocked by scenery
+                }
+            }
+        }
+    }
+
+    return false; // Path appears clear
+}
+
+float findClearTrajectoryAngle(const GameState& state, const Tank& shooter, const Tank& target, float optimalAngle, float power) {
+    PROFILE_FUNCTION();
+    // First check if optimal angle is clear
+    if (!isTrajectoryBlocked(state, shooter, target, optimalAngle, power)) {
+        return optimalAngle;
+    }
+
+    // Try higher angles first (arc over obstacles)
+    for (float angleOffset = 5.0f; angleOffset <= 35.0f; angleOffset += 5.0f) {
+        float highAngle = std::clamp(optimalAngle + angleOffset, 5.0f, MAX_TURRET_SWING - 5.0f);
+        if (!isTrajectoryBlocked(state, shooter, target, highAngle, power)) {
+            return highAngle;
+        }
+    }
+
+    // Try lower angles (more direct shots)
+    for (float angleOffset = 5.0f; angleOffset <= 25.0f; angleOffset += 5.0f) {
+        float lowAngle = std::clamp(optimalAngle - angleOffset, 5.0f, MAX_TURRET_SWING - 5.0f);
+        if (!isTrajectoryBlocked(state, shooter, target, lowAngle, power)) {
+            return lowAngle;
+        }
+    }
+
+    // If no clear path found, return optimal angle anyway (bot will miss but try)
+    return optimalAngle;
+}
+
+ProjectileKind chooseBotAmmo(const Tank& target) {
+    // Simple ammo selection logic
+    float healthRatio = static_cast<float>(target.hp) / static_cast<float>(TANK_HP);
+
+    if (healthRatio > 0.7f) {
+        // Early game - use cluster bombs for area damage
+        return randomFloat(0.0f, 1.0f) > 0.6f ? ProjectileKind::Cluster : ProjectileKind::Mortar;
+    } else if (healthRatio > 0.3f) {
+        // Mid game - mix of weapons
+        float choice = randomFloat(0.0f, 1.0f);
+        if (choice > 0.8f) return ProjectileKind::Napalm;
+        else if (choice > 0.6f) return ProjectileKind::Grenade;
+        else if (choice > 0.3f) return ProjectileKind::Cluster;
+        else return ProjectileKind::Mortar;
+    } else {
+        // Late game - aggressive weapons
+        float choice = randomFloat(0.0f, 1.0f);
+        if (choice > 0.7f) return ProjectileKind::Napalm;
+        else if (choice > 0.4f) return ProjectileKind::Grenade;
+        else return ProjectileKind::Cluster;
+    }
+}
+
+void updateBotAI(GameState& state, Tank& bot, Tank& target, BotBrain& brain, float dt) {
+    PROFILE_FUNCTION();
+    if (brain.enabled) {
+        // Shots arrive on the opponent's turn, so this runs on every tick
+        updateBotShield(state, bot, brain);
+    }
+    if (!brain.enabled || state.currentPlayer != bot.id || state.waitingForTurnEnd) {
+        return;
+    }
+
+    if (brain.phase == BotPhase::Idle) {
+        rollBotTurn(target, brain);
+        brain.phase = BotPhase::Thinking;
+        brain.thinkTimer = 0.0f;
+        brain.thinkDuration = randomFloat(1.0f, 3.0f);
+        brain.planStale = true;
+        brain.planReady = false;
+    } else if (brain.planRevision != state.terrain.revision()) {
+        // The ground moved under the plan (a tower settling, a late crater)
+        brain.planStale = true;
+    }
+    if (brain.planStale) {
+        requestBotShot(state, bot, target, brain);
+    }
+    ShotPlan plan;
+    if (brain.search) {
+        // Refine while thinking; past that, only until there is a shot at all
+        if (!brain.search->finished() && (brain.phase == BotPhase::Thinking || !brain.search->hasSolution())) {
+            brain.search->step(brain.planBudgetNs);
+            if (brain.search->hasSolution()) applyBotShot(brain.search->best(), brain);
+        }
+    } else if (brain.planner && !brain.planStale && brain.planner->poll(plan)) {
+        brain.targetAmmo = plan.kind;
+        applyBotShot(plan.aim, brain);
+    }
+
+    // Cosmetic pause before the turret starts moving; a plan that is still
+    // missing (off-thread, or before the first sliced pass) holds it longer
+    if (brain.phase == BotPhase::Thinking) {
+        brain.thinkTimer += dt;
+        if (brain.thinkTimer < brain.thinkDuration || !brain.planReady) return;
+        brain.phase = BotPhase::Aiming;
+    }
+
+    // Gradually adjust bot's settings toward targets
+    const float adjustSpeed = 60.0f; // degrees per second for angle
+    const float powerAdjustSpeed = 80.0f; // power units per second
+
+    // Adjust angle
+    float angleDiff = brain.targetAngle - bot.turretAngleDeg;
+    if (std::abs(angleDiff) > 0.5f) {
+        float angleStep = std::copysign(std::min(adjustSpeed * dt, std::abs(angleDiff)), angleDiff);
+        bot.turretAngleDeg += angleStep;
+        bot.turretAngleDeg = std::clamp(bot.turretAngleDeg, 0.0f, MAX_TURRET_SWING);
+    }
+
+    // Adjust power
+    float powerDiff = brain.targetPower - bot.launchSpeed;
+    if (std::abs(powerDiff) > 1.0f) {
+        float powerStep = std::copysign(std::min(powerAdjustSpeed * dt, std::abs(powerDiff)), powerDiff);
+        bot.launchSpeed += powerStep;
+        bot.launchSpeed = std::clamp(bot.launchSpeed, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+    }
+
+    // Switch to target ammo
+    if (bot.selected != brain.targetAmmo) {
+        bot.selected = brain.targetAmmo;
+    }
+
+    // Fire when ready and settings are close to targets
+    bool angleReady = std::abs(brain.targetAngle - bot.turretAngleDeg) < 1.0f;
+    bool powerReady = std::abs(brain.targetPower - bot.launchSpeed) < 3.0f;
+    bool ammoReady = bot.selected == brain.targetAmmo;
+
+    if (brain.planReady && angleReady && powerReady && ammoReady && bot.reloadTimer <= 0.0f && !state.shotFired) {
+        // Bot fires
+        launchProjectile(state, spawnProjectile(bot));
+        bot.reloadTimer = RELOAD_TIME;
+        state.shotFired = true;
+        state.waitingForTurnEnd = true;
+        state.turnEndTimer = 3.0f;
+
+        // Increment bot shot count and make force field available every 5 shots (same as human player)
+        bot.shotsFired++;
+        if (bot.shotsFired % 5 == 0) {
+            bot.forceFieldAvailable = true;
+        }
+
+        // Plan afresh next turn
+        brain.phase = BotPhase::Idle;
+    }
+}
+
+} // namespace tankduel
@@ -0,0 +1,18 @@
+// src/core/bot.h
+#pragma once
+
+#include "game_state.h"
+
+namespace tankduel {
+
+float calculateOptimalAngle(const Tank& botTank, const Tank& targetTank, float power);
+float calculateOptimalPower(const Tank& botTank, const Tank& targetTank);
+bool isTrajectoryBlocked(const GameState& state, const Tank& shooter, const Tank& target, float angle, float power);
+float findClearTrajectoryAngle(const GameState& state, const Tank& shooter, const Tank& target, float optimalAngle, float power);
+ProjectileKind chooseBotAmmo(const Tank& target);
+
+// Drives `bot` against `target` while it is that tank's turn, and raises its
+// shield against predicted incoming fire on any tick.
+void updateBotAI(GameState& state, Tank& bot, Tank& target, BotBrain& brain, float dt);
+
+} // namespace tankduel
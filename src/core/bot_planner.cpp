@@ -0,0 +1,73 @@
+// src/core/bot_planner.cpp
+#include "bot_planner.h"
+
+#include "profiler.h"
+
+namespace tankduel {
+
+BotPlanner::BotPlanner() : worker_([this] { workerLoop(); }) {}
+
+BotPlanner::~BotPlanner() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+bool BotPlanner::submit(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                        const ShotGrid& grid, const RolloutSettings* rollouts) {
+    if (busy()) return false;
+    useRollouts_ = rollouts != nullptr;
+    if (useRollouts_) {
+        rollouts_ = *rollouts;
+        cloneSimState(snapshot_, state);
+    } else {
+        snapshot_.terrain = state.terrain;
+        snapshot_.scenery = state.scenery;
+    }
+    shooter_ = shooter;
+    target_ = target;
+    kind_ = kind;
+    grid_ = grid;
+    {
+        // Taking the wake lock orders the request before the worker's re-check
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        requested_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_one();
+    return true;
+}
+
+bool BotPlanner::poll(ShotPlan& plan) {
+    const std::uint32_t latest = requested_.load(std::memory_order_relaxed);
+    if (collected_ == latest || finished_.load(std::memory_order_acquire) != latest) return false;
+    plan = result_;
+    collected_ = latest;
+    return true;
+}
+
+void BotPlanner::workerLoop() {
+    std::uint32_t served = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wake_.wait(lock, [&] { return stopping_ || requested_.load(std::memory_order_acquire) != served; });
+            if (stopping_) return;
+        }
+        served = requested_.load(std::memory_order_acquire);
+        {
+            PROFILE_ZONE("planBotShot");
+            if (useRollouts_) {
+                result_ = planShotByRollouts(snapshot_, shooter_, target_, table_, grid_, rollouts_);
+            } else {
+                result_.kind = kind_;
+                result_.aim = table_.lookup(snapshot_, shooter_, target_, kind_, grid_);
+            }
+        }
+        finished_.store(served, std::memory_order_release);
+    }
+}
+
+} // namespace tankduel
@@ -0,0 +1,60 @@
+// src/core/bot_planner.h
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "firing_table.h"
+#include "game_state.h"
+#include "rollout.h"
+
+namespace tankduel {
+
+// Background thread that aims a bot's shots, so a dense search never stalls
+// the frame. The simulation thread submits a copy of what the solver reads
+// and later polls for the answer; results come back through sequence
+// counters, so polling never blocks. One request is in flight at a time.
+class BotPlanner {
+public:
+    BotPlanner();
+    ~BotPlanner();
+
+    BotPlanner(const BotPlanner&) = delete;
+    BotPlanner& operator=(const BotPlanner&) = delete;
+
+    // Snapshots terrain, scenery and both tanks and queues a solve for
+    // `kind`; with `rollouts` it clones the whole simulation and picks the
+    // ammo by rollouts instead. False while the previous request still runs.
+    bool submit(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                const ShotGrid& grid, const RolloutSettings* rollouts = nullptr);
+    // Takes the answer to the latest request once it is ready.
+    bool poll(ShotPlan& plan);
+    bool busy() const { return finished_.load(std::memory_order_acquire) != requested_.load(std::memory_order_relaxed); }
+
+private:
+    void workerLoop();
+
+    // Owned by the worker between submit and the matching finish
+    GameState snapshot_{};
+    Tank shooter_{};
+    Tank target_{};
+    ProjectileKind kind_{ProjectileKind::Mortar};
+    ShotGrid grid_{};
+    bool useRollouts_{false};
+    RolloutSettings rollouts_{};
+    FiringTable table_{};
+    ShotPlan result_{};
+
+    std::atomic<std::uint32_t> requested_{0};
+    std::atomic<std::uint32_t> finished_{0};
+    std::uint32_t collected_{0};  // simulation thread only
+    std::atomic<bool> stopping_{false};
+
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::thread worker_;
+};
+
+} // namespace tankduel
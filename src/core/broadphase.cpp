@@ -0,0 +1,85 @@
+// src/core/broadphase.cpp
+#include "broadphase.h"
+
+#include <algorithm>
+
+namespace tankduel {
+
+namespace {
+
+// Dense slot per collider: scenery, then the two tanks, then their force fields
+int slotOf(ColliderRef ref) {
+    switch (ref.kind) {
+        case ColliderKind::Scenery: return ref.index;
+        case ColliderKind::Tank: return MAX_SCENERY_OBJECTS + ref.index;
+        case ColliderKind::ForceField: return MAX_SCENERY_OBJECTS + 2 + ref.index;
+    }
+    return 0;
+}
+
+} // namespace
+
+void Broadphase::clear() {
+    for (auto& column : columns_) {
+        column.clear();
+    }
+    spans_.fill(ColumnSpan{});
+}
+
+void Broadphase::place(ColliderRef ref, float minX, float maxX) {
+    const int first = columnAt(minX);
+    const int last = columnAt(maxX);
+    const int slot = slotOf(ref);
+    if (spans_[slot].first == first && spans_[slot].last == last) return;
+
+    remove(ref);
+    // Buckets stay sorted by slot so single-column queries need no sorting
+    for (int column = first; column <= last; ++column) {
+        ColliderList& bucket = columns_[column];
+        bucket.push_back(ref);
+        for (auto it = bucket.end() - 1; it != bucket.begin() && slotOf(*(it - 1)) > slot; --it) {
+            std::swap(*it, *(it - 1));
+        }
+    }
+    spans_[slot] = ColumnSpan{ first, last };
+}
+
+void Broadphase::remove(ColliderRef ref) {
+    const int slot = slotOf(ref);
+    ColumnSpan& span = spans_[slot];
+    if (span.first < 0) return;
+
+    for (int column = span.first; column <= span.last; ++column) {
+        ColliderList& bucket = columns_[column];
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                    [slot](ColliderRef entry) { return slotOf(entry) == slot; }),
+                     bucket.end());
+    }
+    span = ColumnSpan{};
+}
+
+void Broadphase::query(float minX, float maxX, ColliderList& out) const {
+    out.clear();
+    const int first = columnAt(minX);
+    const int last = columnAt(maxX);
+    for (ColliderRef ref : columns_[first]) {
+        out.push_back(ref);
+    }
+    if (first == last) return;
+
+    // Wide queries merge several buckets: skip repeats, then restore slot order
+    const std::size_t single = out.size();
+    for (int column = first + 1; column <= last; ++column) {
+        for (ColliderRef ref : columns_[column]) {
+            auto seen = std::find_if(out.begin(), out.end(),
+                                     [ref](ColliderRef entry) { return slotOf(entry) == slotOf(ref); });
+            if (seen == out.end()) out.push_back(ref);
+        }
+    }
+    if (out.size() != single) {
+        std::sort(out.begin(), out.end(),
+                  [](ColliderRef a, ColliderRef b) { return slotOf(a) < slotOf(b); });
+    }
+}
+
+} // namespace tankduel
@@ -0,0 +1,56 @@
+// src/core/broadphase.h
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "constants.h"
+#include "fixed_vector.h"
+
+namespace tankduel {
+
+enum class ColliderKind : std::uint8_t { Scenery, Tank, ForceField };
+
+struct ColliderRef {
+    ColliderKind kind{ColliderKind::Scenery};
+    std::uint16_t index{0}; // scenery index, or 0/1 for player1/player2
+};
+
+constexpr int BROADPHASE_COLUMN_WIDTH = 32;
+constexpr int BROADPHASE_COLUMNS = (LOGICAL_WIDTH + BROADPHASE_COLUMN_WIDTH - 1) / BROADPHASE_COLUMN_WIDTH;
+constexpr int BROADPHASE_MAX_COLLIDERS = MAX_SCENERY_OBJECTS + 4;
+
+using ColliderList = FixedVector<ColliderRef, BROADPHASE_MAX_COLLIDERS>;
+
+// Uniform column buckets over the world width. Only x extents are bucketed:
+// towers and tanks fall straight down, so a collider is rebucketed only when
+// it is added, removed or changes width (force fields). Narrowphase tests read
+// the live objects from GameState.
+class Broadphase {
+public:
+    void clear();
+    // Registers or moves a collider; a no-op when its columns are unchanged
+    void place(ColliderRef ref, float minX, float maxX);
+    void remove(ColliderRef ref);
+    // Colliders overlapping the columns of [minX, maxX], each listed once,
+    // scenery first in index order, then tanks, then force fields
+    void query(float minX, float maxX, ColliderList& out) const;
+
+    // Raw bucket access for hot loops that tolerate repeats across columns
+    static int columnAt(float x) {
+        const float column = std::clamp(x / BROADPHASE_COLUMN_WIDTH, 0.0f, static_cast<float>(BROADPHASE_COLUMNS - 1));
+        return static_cast<int>(column);
+    }
+    const ColliderList& bucket(int column) const { return columns_[column]; }
+
+private:
+    struct ColumnSpan {
+        int first{-1};
+        int last{-1};
+    };
+
+    std::array<ColliderList, BROADPHASE_COLUMNS> columns_{};
+    std::array<ColumnSpan, BROADPHASE_MAX_COLLIDERS> spans_{};
+};
+
+} // namespace tankduel
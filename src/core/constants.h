@@ -0,0 +1,80 @@
+// src/core/constants.h
+#pragma once
+
+namespace tankduel {
+
+constexpr int LOGICAL_WIDTH  = 640;
+constexpr int LOGICAL_HEIGHT = 384;
+
+// Simulation runs on a fixed tick; rendering interpolates between ticks.
+constexpr int DEFAULT_TICK_RATE = 60;
+constexpr int MIN_TICK_RATE = 20;
+constexpr int MAX_TICK_RATE = 480;
+constexpr int DEFAULT_MAX_CATCHUP_TICKS = 5;
+constexpr double MAX_FRAME_TIME = 0.25;
+
+constexpr float DEFAULT_LAUNCH_SPEED   = 160.0f;
+constexpr float MIN_LAUNCH_SPEED       = 90.0f;
+constexpr float MAX_LAUNCH_SPEED       = 260.0f;
+constexpr float POWER_ADJUST_RATE      = 110.0f;
+
+constexpr int DAMAGE_MORTAR            = 24;
+constexpr int DAMAGE_CLUSTER           = 16;
+constexpr int DAMAGE_CLUSTER_SHARD     = 12;
+constexpr int DAMAGE_NAPALM_DIRECT     = 18;
+constexpr int DAMAGE_GRENADE           = 20;
+constexpr int DAMAGE_DIRTGUN           = 0;
+constexpr int TANK_HP = 100;
+constexpr float RELOAD_TIME = 0.45f;
+constexpr float GRAVITY = 120.0f;
+constexpr float TURRET_ROT_SPEED = 120.0f;
+constexpr float MAX_TURRET_SWING = 90.0f;
+constexpr float DEG2RAD = 0.0174532925f;
+constexpr float PI = 3.14159265f;
+
+constexpr float TERRAIN_BASELINE = LOGICAL_HEIGHT - 70.0f;
+
+constexpr float TANK_COLLISION_WIDTH = 9.0f;
+constexpr float TANK_COLLISION_HEIGHT = 5.0f;
+
+constexpr float TANK_SCALE = 0.28f;
+
+constexpr float HULL_TEXTURE_WIDTH = 72.0f;
+constexpr float HULL_TEXTURE_HEIGHT = 28.0f;
+constexpr float HULL_DRAW_WIDTH = HULL_TEXTURE_WIDTH * TANK_SCALE;
+constexpr float HULL_DRAW_HEIGHT = HULL_TEXTURE_HEIGHT * TANK_SCALE;
+constexpr float HULL_OFFSET_X = (HULL_DRAW_WIDTH - TANK_COLLISION_WIDTH) * 0.5f;
+constexpr float HULL_OFFSET_Y = 10.0f * TANK_SCALE;
+
+constexpr float TURRET_TEXTURE_WIDTH = 64.0f;
+constexpr float TURRET_TEXTURE_HEIGHT = 24.0f;
+constexpr float TURRET_DRAW_WIDTH = TURRET_TEXTURE_WIDTH * TANK_SCALE;
+constexpr float TURRET_DRAW_HEIGHT = TURRET_TEXTURE_HEIGHT * TANK_SCALE;
+constexpr float TURRET_PIVOT_X = 18.0f * TANK_SCALE;
+constexpr float TURRET_PIVOT_Y = 16.0f * TANK_SCALE;
+
+constexpr float TURRET_PIVOT_WORLD_OFFSET_Y = -1.4f;
+constexpr float MUZZLE_LENGTH = 32.0f * TANK_SCALE;
+
+constexpr float RADIUS_MORTAR = 3.2f;
+constexpr float RADIUS_CLUSTER = 3.0f;
+constexpr float RADIUS_CLUSTER_SHARD = 2.2f;
+constexpr float RADIUS_NAPALM = 3.8f;
+constexpr float RADIUS_GRENADE = 2.8f;
+constexpr float RADIUS_DIRTGUN = 2.5f;
+
+constexpr float CLUSTER_SPLIT_TIME = 0.45f;
+constexpr float CLUSTER_SPREAD = 0.22f;
+
+constexpr float NAPALM_BURN_DURATION = 1.2f;
+constexpr float NAPALM_EROSION_RATE = 32.0f;
+constexpr float EXPLOSION_DURATION = 0.45f;
+constexpr float TANK_EXPLOSION_DURATION = 1.2f;
+
+// Fixed pool sizes; spawns beyond these are dropped rather than allocated
+constexpr int MAX_PROJECTILES = 1024;
+constexpr int MAX_EXPLOSIONS = 256;
+constexpr int MAX_NAPALM_PATCHES = 64;
+constexpr int MAX_SCENERY_OBJECTS = 64;
+
+} // namespace tankduel
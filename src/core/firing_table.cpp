@@ -0,0 +1,56 @@
+// src/core/firing_table.cpp
+#include "firing_table.h"
+
+#include <cmath>
+
+#include "game_state.h"
+#include "profiler.h"
+
+namespace tankduel {
+
+const ShotSolution& FiringTable::lookup(const GameState& state, const Tank& shooter, const Tank& target,
+                                        ProjectileKind kind, const ShotGrid& grid) {
+    PROFILE_FUNCTION();
+    // Tanks only settle vertically, so whole pixels are a stable key
+    Entry key;
+    key.shooterX = static_cast<int>(std::lround(shooter.rect.x));
+    key.shooterY = static_cast<int>(std::lround(shooter.rect.y));
+    key.targetX = static_cast<int>(std::lround(target.rect.x));
+    key.targetY = static_cast<int>(std::lround(target.rect.y));
+    key.facingRight = shooter.facingRight;
+    key.kind = kind;
+    key.grid = grid;
+
+    const std::uint32_t revision = state.terrain.revision();
+    for (Entry& entry : entries_) {
+        if (!entry.valid || entry.shooterX != key.shooterX || entry.shooterY != key.shooterY ||
+            entry.targetX != key.targetX || entry.targetY != key.targetY || entry.facingRight != key.facingRight ||
+            entry.kind != key.kind || !(entry.grid == key.grid)) {
+            continue;
+        }
+        if (entry.revision != revision) {
+            const ColumnRange edited = state.terrain.dirtySince(entry.revision);
+            if (!entry.solution.hits || edited.overlaps(entry.solution.arc.first, entry.solution.arc.last)) {
+                entry.valid = false;
+                continue;
+            }
+            entry.revision = revision;
+        }
+        return entry.solution;
+    }
+
+    Entry& slot = entries_[nextSlot_];
+    nextSlot_ = (nextSlot_ + 1) % entries_.size();
+    slot = key;
+    slot.valid = true;
+    slot.revision = revision;
+    slot.solution = solveShot(state, shooter, target, kind, grid);
+    return slot.solution;
+}
+
+void FiringTable::clear() {
+    entries_ = {};
+    nextSlot_ = 0;
+}
+
+} // namespace tankduel
@@ -0,0 +1,41 @@
+// src/core/firing_table.h
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "shot_solver.h"
+
+namespace tankduel {
+
+constexpr std::size_t FIRING_TABLE_ENTRIES = 8;
+
+// A bot's memo of solveShot results, filled on first use. Entries are keyed
+// on where both tanks stand, the ammo kind and the search grid, and survive terrain edits that
+// stay clear of the columns under their arc. A miss depends on the whole map,
+// so any edit drops it.
+class FiringTable {
+public:
+    const ShotSolution& lookup(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                               const ShotGrid& grid = ShotGrid{});
+    void clear();
+
+private:
+    struct Entry {
+        bool valid{false};
+        int shooterX{0};
+        int shooterY{0};
+        int targetX{0};
+        int targetY{0};
+        bool facingRight{true};
+        ProjectileKind kind{ProjectileKind::Mortar};
+        ShotGrid grid{};
+        std::uint32_t revision{0};  // terrain revision the arc was last checked at
+        ShotSolution solution{};
+    };
+
+    std::array<Entry, FIRING_TABLE_ENTRIES> entries_{};
+    std::size_t nextSlot_{0};
+};
+
+} // namespace tankduel
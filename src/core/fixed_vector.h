@@ -0,0 +1,53 @@
+// src/core/fixed_vector.h
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace tankduel {
+
+// Inline, fixed-capacity vector: never touches the heap and copies as a plain
+// block. push_back refuses new items once full.
+template <typename T, std::size_t Capacity>
+class FixedVector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    bool push_back(const T& value) {
+        if (size_ == Capacity) return false;
+        items_[size_++] = value;
+        return true;
+    }
+
+    // Removes [first, last), shifting the tail down (erase-remove friendly)
+    iterator erase(iterator first, iterator last) {
+        iterator out = first;
+        for (iterator in = last; in != end(); ++in, ++out) {
+            *out = std::move(*in);
+        }
+        size_ = static_cast<std::size_t>(out - begin());
+        return first;
+    }
+
+    void clear() { size_ = 0; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == Capacity; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    T& operator[](std::size_t index) { return items_[index]; }
+    const T& operator[](std::size_t index) const { return items_[index]; }
+
+    iterator begin() { return items_.data(); }
+    iterator end() { return items_.data() + size_; }
+    const_iterator begin() const { return items_.data(); }
+    const_iterator end() const { return items_.data() + size_; }
+
+private:
+    std::array<T, Capacity> items_{};
+    std::size_t size_{0};
+};
+
+} // namespace tankduel
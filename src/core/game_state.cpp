@@ -0,0 +1,54 @@
+// src/core/game_state.cpp
+#include "game_state.h"
+
+namespace tankduel {
+
+ProjectileKind nextAmmoType(ProjectileKind current) {
+    switch (current) {
+        case ProjectileKind::Mortar: return ProjectileKind::Cluster;
+        case ProjectileKind::Cluster: return ProjectileKind::Napalm;
+        case ProjectileKind::Napalm: return ProjectileKind::Grenade;
+        case ProjectileKind::Grenade: return ProjectileKind::Dirtgun;
+        case ProjectileKind::Dirtgun: return ProjectileKind::Mortar;
+        case ProjectileKind::ClusterShard: return ProjectileKind::Mortar;
+    }
+    return ProjectileKind::Mortar;
+}
+
+const char* ammoDisplayName(ProjectileKind kind) {
+    switch (kind) {
+        case ProjectileKind::Mortar: return "Mortar";
+        case ProjectileKind::Cluster: return "Cluster";
+        case ProjectileKind::Napalm: return "Napalm";
+        case ProjectileKind::Grenade: return "Grenade";
+        case ProjectileKind::Dirtgun: return "Dirtgun";
+        case ProjectileKind::ClusterShard: return "Cluster";
+    }
+    return "Mortar";
+}
+
+void cloneSimState(GameState& out, const GameState& state) {
+    out.player1 = state.player1;
+    out.player2 = state.player2;
+    out.projectiles.copyLiveFrom(state.projectiles);
+    out.explosions = state.explosions;
+    out.napalmPatches = state.napalmPatches;
+    out.scenery = state.scenery;
+    out.broadphase = state.broadphase;
+    out.terrain = state.terrain;
+    out.matchOver = state.matchOver;
+    out.winner = state.winner;
+    out.resetTimer = state.resetTimer;
+    out.currentPlayer = state.currentPlayer;
+    out.waitingForTurnEnd = state.waitingForTurnEnd;
+    out.turnEndTimer = state.turnEndTimer;
+    out.shotFired = state.shotFired;
+    out.currentScreen = state.currentScreen;
+    out.gameMode = state.gameMode;
+    out.difficulty = state.difficulty;
+    out.playMode = state.playMode;
+    out.player1Bot.enabled = false;
+    out.player2Bot.enabled = false;
+}
+
+} // namespace tankduel
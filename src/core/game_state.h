@@ -0,0 +1,155 @@
+// src/core/game_state.h
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "broadphase.h"
+#include "constants.h"
+#include "firing_table.h"
+#include "fixed_vector.h"
+#include "input.h"
+#include "math.h"
+#include "projectile_store.h"
+#include "terrain_state.h"
+
+namespace tankduel {
+
+enum class SceneryKind { Tower };
+
+enum class GameMode { OnePlayer, TwoPlayer };
+
+enum class Difficulty { Easy, Medium, Hard };
+
+enum class PlayMode { TurnBased, FreeForAll };
+
+enum class GameScreen { Menu, DifficultySelect, ModeSelect, Playing, Paused, Help };
+
+ProjectileKind nextAmmoType(ProjectileKind current);
+const char* ammoDisplayName(ProjectileKind kind);
+
+struct Explosion {
+    Vec2 position{};
+    float timer{EXPLOSION_DURATION};
+    float duration{EXPLOSION_DURATION};
+    float maxRadius{22.0f};
+    bool isTankExplosion{false};
+};
+
+struct NapalmPatch {
+    Vec2 position{};
+    float radius{28.0f};
+    float currentRadius{0.0f};
+    float timer{NAPALM_BURN_DURATION};
+};
+
+using ExplosionList = FixedVector<Explosion, MAX_EXPLOSIONS>;
+using NapalmPatchList = FixedVector<NapalmPatch, MAX_NAPALM_PATCHES>;
+
+struct SceneryObject {
+    Rect rect{};
+    SceneryKind kind{};
+    float health{100.0f};
+    float maxHealth{100.0f};
+    bool alive{true};
+    float verticalVelocity{0.0f};
+    bool falling{false};
+};
+
+struct Tank {
+    Rect rect{};
+    float turretAngleDeg{45.0f};
+    float reloadTimer{0.0f};
+    float launchSpeed{DEFAULT_LAUNCH_SPEED};
+    float verticalVelocity{0.0f};
+    ProjectileKind selected{ProjectileKind::Mortar};
+    int hp{TANK_HP};
+    Key aimUp{};
+    Key aimDown{};
+    Key powerUp{};
+    Key powerDown{};
+    Key fire{};
+    Key nextAmmo{};
+    Key activateForceField{};
+    int id{};
+    bool facingRight{true};
+    bool exploding{false};
+    float explosionTimer{0.0f};
+    bool ammoSwitchHeld{false};
+    bool forceFieldKeyHeld{false};
+    int shotsFired{0};
+    bool forceFieldActive{false};
+    bool forceFieldAvailable{true};
+    float forceFieldRadius{35.0f};
+};
+
+// Idle until its turn; the shot is planned once on entering Thinking, which
+// only waits out a cosmetic delay; Aiming slews the turret and fires.
+enum class BotPhase { Idle, Thinking, Aiming };
+
+class BotPlanner;
+class WorkStealingPool;
+
+// Per-tank AI controller. Either tank can be bot driven (headless runs use two).
+struct BotBrain {
+    bool enabled{false};
+    Difficulty difficulty{Difficulty::Medium};
+    BotPhase phase{BotPhase::Idle};
+    float thinkTimer{0.0f};
+    float thinkDuration{0.0f};
+    float angleError{0.0f};  // this turn's difficulty error
+    float powerError{0.0f};
+    bool planStale{true};    // a shot should be (re)requested
+    bool planReady{false};   // target angle/power hold the current plan
+    std::uint32_t planRevision{0};  // terrain revision the plan was made against
+    float targetAngle{45.0f};
+    float targetPower{DEFAULT_LAUNCH_SPEED};
+    ProjectileKind targetAmmo{ProjectileKind::Mortar};
+    FiringTable firingTable{};
+    BotPlanner* planner{nullptr};  // not owned; when set, shots are solved off-thread
+    ShotSearch* search{nullptr};   // not owned; when set, shots are refined a slice per tick
+    std::uint64_t planBudgetNs{1000000};  // CPU per tick for `search`
+    int rolloutSamples{0};  // > 0: ammo chosen by full-physics rollouts (not with `search`)
+    WorkStealingPool* rolloutPool{nullptr};  // not owned; runs the rollouts in parallel
+    std::uint32_t rolloutSeed{0};  // this turn's, drawn on the simulation thread
+    ProjectileHandle shieldThreat{};  // last incoming projectile the shield roll was made for
+    bool shieldAnswer{false};         // whether to raise the shield against it
+};
+
+struct GameState {
+    Tank player1{};
+    Tank player2{};
+    ProjectileStore projectiles{};
+    ExplosionList explosions{};
+    NapalmPatchList napalmPatches{};
+    std::vector<SceneryObject> scenery{};
+    Broadphase broadphase{};
+    Terrain terrain{};
+    bool matchOver{false};
+    int winner{0};
+    float resetTimer{2.0f};
+
+    // Turn-based system
+    int currentPlayer{1};  // 1 or 2
+    bool waitingForTurnEnd{false};
+    float turnEndTimer{0.0f};
+    bool shotFired{false};
+
+    // Menu and game mode system
+    GameScreen currentScreen{GameScreen::Menu};
+    GameMode gameMode{GameMode::TwoPlayer};
+    Difficulty difficulty{Difficulty::Medium};
+    PlayMode playMode{PlayMode::TurnBased};
+    int menuSelection{0};  // 0 = 1 Player, 1 = 2 Player
+    int pauseMenuSelection{0};  // 0 = Continue, 1 = Quit Game
+
+    // Bot AI system
+    BotBrain player1Bot{};
+    BotBrain player2Bot{};
+};
+
+// Copies everything stepSimulation reads into `out` for a throwaway rollout:
+// buffers are reused and only the live span of the projectile pool is
+// touched. Both bots come out switched off; menus are not copied.
+void cloneSimState(GameState& out, const GameState& state);
+
+} // namespace tankduel
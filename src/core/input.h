@@ -0,0 +1,19 @@
+// src/core/input.h
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tankduel {
+
+// Keys the simulation reacts to. The front end maps its own key codes onto these.
+enum class Key : std::uint8_t { Q, A, W, S, E, R, Space, I, K, O, L, P, U, Return, Count };
+
+struct InputState {
+    std::array<bool, static_cast<std::size_t>(Key::Count)> down{};
+
+    bool isDown(Key key) const { return down[static_cast<std::size_t>(key)]; }
+    void set(Key key, bool pressed) { down[static_cast<std::size_t>(key)] = pressed; }
+};
+
+} // namespace tankduel
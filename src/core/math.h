@@ -0,0 +1,23 @@
+// src/core/math.h
+#pragma once
+
+namespace tankduel {
+
+// Plain float point/rect so the simulation does not depend on SDL_FPoint/SDL_FRect.
+struct Vec2 {
+    float x{};
+    float y{};
+};
+
+struct Rect {
+    float x{};
+    float y{};
+    float w{};
+    float h{};
+};
+
+inline float lerp(float a, float b, float t) {
+    return a + (b - a) * t;
+}
+
+} // namespace tankduel
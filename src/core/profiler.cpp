@@ -0,0 +1,112 @@
+// src/core/profiler.cpp
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tankduel {
+
+namespace detail {
+std::atomic<bool> profilingEnabled{false};
+thread_local std::uint32_t profileDepth = 0;
+} // namespace detail
+
+namespace {
+
+// Written only by its owning thread; `written` counts every zone ever stored,
+// so the live window is the last min(written, capacity) slots.
+struct ThreadProfile {
+    std::uint32_t threadId{0};
+    std::vector<ProfileEvent> events;
+    std::atomic<std::uint64_t> written{0};
+};
+
+struct ProfileRegistry {
+    std::mutex mutex;
+    // Shared so buffers of finished worker threads survive until export.
+    std::vector<std::shared_ptr<ThreadProfile>> threads;
+};
+
+ProfileRegistry& registry() {
+    static ProfileRegistry instance;
+    return instance;
+}
+
+ThreadProfile& threadProfile() {
+    thread_local std::shared_ptr<ThreadProfile> profile;
+    if (!profile) {
+        profile = std::make_shared<ThreadProfile>();
+        profile->events.resize(PROFILE_RING_CAPACITY);
+        ProfileRegistry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        profile->threadId = static_cast<std::uint32_t>(reg.threads.size() + 1);
+        reg.threads.push_back(profile);
+    }
+    return *profile;
+}
+
+void writeEscaped(std::FILE* file, const char* text) {
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\') std::fputc('\\', file);
+        std::fputc(*text, file);
+    }
+}
+
+} // namespace
+
+void startProfiling() {
+    profileClockNs();  // pin the epoch before the first zone
+    detail::profilingEnabled.store(true, std::memory_order_relaxed);
+}
+
+void stopProfiling() {
+    detail::profilingEnabled.store(false, std::memory_order_relaxed);
+}
+
+std::uint64_t profileClockNs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+void detail::recordZone(const char* name, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth) {
+    ThreadProfile& profile = threadProfile();
+    const std::uint64_t index = profile.written.load(std::memory_order_relaxed);
+    ProfileEvent& event = profile.events[index % PROFILE_RING_CAPACITY];
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    event.depth = depth;
+    profile.written.store(index + 1, std::memory_order_release);
+}
+
+bool writeChromeTrace(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+    bool first = true;
+    ProfileRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& profile : reg.threads) {
+        const std::uint64_t written = profile->written.load(std::memory_order_acquire);
+        const std::uint64_t count = std::min<std::uint64_t>(written, PROFILE_RING_CAPACITY);
+        for (std::uint64_t i = written - count; i < written; ++i) {
+            const ProfileEvent& event = profile->events[i % PROFILE_RING_CAPACITY];
+            std::fputs(first ? "\n{\"name\":\"" : ",\n{\"name\":\"", file);
+            writeEscaped(file, event.name);
+            std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+                         profile->threadId, static_cast<double>(event.startNs) / 1000.0,
+                         static_cast<double>(event.durationNs) / 1000.0, event.depth);
+            first = false;
+        }
+    }
+    std::fputs("\n]}\n", file);
+    return std::fclose(file) == 0;
+}
+
+} // namespace tankduel
@@ -0,0 +1,81 @@
+// src/core/profiler.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace tankduel {
+
+// One closed zone as stored in a thread's ring buffer.
+struct ProfileEvent {
+    const char* name{nullptr};
+    std::uint64_t startNs{0};
+    std::uint64_t durationNs{0};
+    std::uint32_t depth{0};
+};
+
+// Zones per thread kept before the oldest are overwritten (a minute or more of frames).
+constexpr std::size_t PROFILE_RING_CAPACITY = 1u << 18;
+
+#if defined(TANK_DUEL_PROFILER)
+constexpr bool PROFILER_COMPILED_IN = true;
+#else
+constexpr bool PROFILER_COMPILED_IN = false;
+#endif
+
+// Recording is off until started, so compiled-in zones cost one relaxed load.
+void startProfiling();
+void stopProfiling();
+
+// Nanoseconds on a steady clock since the first call in this process.
+std::uint64_t profileClockNs();
+
+// Writes every buffered zone as Chrome trace-event JSON (chrome://tracing,
+// Perfetto). Call once the threads being traced are idle.
+bool writeChromeTrace(const std::string& path);
+
+namespace detail {
+extern std::atomic<bool> profilingEnabled;
+extern thread_local std::uint32_t profileDepth;
+void recordZone(const char* name, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth);
+} // namespace detail
+
+// Times its own lifetime; name must outlive the trace (string literal or __func__).
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name)
+        : name_(name), active_(detail::profilingEnabled.load(std::memory_order_relaxed)) {
+        if (active_) {
+            depth_ = detail::profileDepth++;
+            startNs_ = profileClockNs();
+        }
+    }
+    ~ProfileZone() {
+        if (active_) {
+            detail::recordZone(name_, startNs_, profileClockNs(), depth_);
+            --detail::profileDepth;
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_;
+    bool active_;
+    std::uint32_t depth_{0};
+    std::uint64_t startNs_{0};
+};
+
+} // namespace tankduel
+
+#define TANK_DUEL_PROFILE_CONCAT_INNER(a, b) a##b
+#define TANK_DUEL_PROFILE_CONCAT(a, b) TANK_DUEL_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(TANK_DUEL_PROFILER)
+#define PROFILE_ZONE(name) ::tankduel::ProfileZone TANK_DUEL_PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
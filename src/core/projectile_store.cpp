@@ -0,0 +1,184 @@
+// src/core/projectile_store.cpp
+#include "projectile_store.h"
+
+#include <algorithm>
+
+#include "simd.h"
+
+namespace tankduel {
+
+static_assert(MAX_PROJECTILES % simd::WIDTH == 0, "kernels read whole vectors past span()");
+static_assert(MAX_PROJECTILES <= 65536, "free list stores 16-bit slots");
+
+namespace {
+
+// Kernels run on whole vectors; lanes past span() are free slots, which keep
+// a fuse of NO_FUSE and are otherwise ignored.
+std::size_t paddedSpan(const ProjectileStore& store) {
+    return (store.span() + simd::WIDTH - 1) / simd::WIDTH * simd::WIDTH;
+}
+
+void appendLanes(ProjectileIndexList& out, std::size_t base, int laneBits) {
+    for (int lane = 0; laneBits != 0; ++lane, laneBits >>= 1) {
+        if (laneBits & 1) {
+            out.push_back(static_cast<std::uint32_t>(base + lane));
+        }
+    }
+}
+
+} // namespace
+
+void ProjectileStore::clear() {
+    alive.fill(0);
+    fuseTime.fill(NO_FUSE);
+    // Pop order hands out slot 0 first so live projectiles stay packed low
+    for (std::size_t i = 0; i < capacity(); ++i) {
+        freeSlots_[i] = static_cast<std::uint16_t>(capacity() - 1 - i);
+    }
+    freeCount_ = capacity();
+    span_ = 0;
+    liveCount_ = 0;
+}
+
+void ProjectileStore::copyLiveFrom(const ProjectileStore& other) {
+    const std::size_t count = std::max(span_, other.span_);
+    auto copyColumn = [count](auto& to, const auto& from) {
+        std::copy(from.begin(), from.begin() + count, to.begin());
+    };
+    copyColumn(posX, other.posX);
+    copyColumn(posY, other.posY);
+    copyColumn(prevX, other.prevX);
+    copyColumn(prevY, other.prevY);
+    copyColumn(velX, other.velX);
+    copyColumn(velY, other.velY);
+    copyColumn(radius, other.radius);
+    copyColumn(age, other.age);
+    copyColumn(fuseTime, other.fuseTime);
+    copyColumn(kind, other.kind);
+    copyColumn(damage, other.damage);
+    copyColumn(owner, other.owner);
+    copyColumn(bouncesRemaining, other.bouncesRemaining);
+    copyColumn(alive, other.alive);
+    copyColumn(generation, other.generation);
+    std::copy(other.freeSlots_.begin(), other.freeSlots_.begin() + other.freeCount_, freeSlots_.begin());
+    freeCount_ = other.freeCount_;
+    span_ = other.span_;
+    liveCount_ = other.liveCount_;
+}
+
+ProjectileHandle ProjectileStore::spawn(const Projectile& proj) {
+    if (freeCount_ == 0) return ProjectileHandle{};
+
+    const std::size_t slot = freeSlots_[--freeCount_];
+    posX[slot] = proj.position.x;
+    posY[slot] = proj.position.y;
+    prevX[slot] = proj.position.x;
+    prevY[slot] = proj.position.y;
+    velX[slot] = proj.velocity.x;
+    velY[slot] = proj.velocity.y;
+    radius[slot] = proj.radius;
+    age[slot] = proj.age;
+    fuseTime[slot] = proj.fuseTime;
+    kind[slot] = proj.kind;
+    damage[slot] = proj.damage;
+    owner[slot] = proj.owner;
+    bouncesRemaining[slot] = proj.bouncesRemaining;
+    alive[slot] = 1;
+
+    ++liveCount_;
+    if (slot + 1 > span_) span_ = slot + 1;
+    return handleAt(slot);
+}
+
+void ProjectileStore::release(std::size_t slot) {
+    if (!alive[slot]) return;
+    alive[slot] = 0;
+    fuseTime[slot] = NO_FUSE;
+    ++generation[slot];
+    freeSlots_[freeCount_++] = static_cast<std::uint16_t>(slot);
+    --liveCount_;
+    while (span_ > 0 && !alive[span_ - 1]) {
+        --span_;
+    }
+}
+
+bool ProjectileStore::contains(ProjectileHandle handle) const {
+    return handle.slot < capacity() && alive[handle.slot] && generation[handle.slot] == handle.generation;
+}
+
+ProjectileHandle ProjectileStore::handleAt(std::size_t slot) const {
+    return ProjectileHandle{ static_cast<std::uint32_t>(slot), generation[slot] };
+}
+
+Projectile ProjectileStore::get(std::size_t slot) const {
+    Projectile proj;
+    proj.position = position(slot);
+    proj.velocity = Vec2{ velX[slot], velY[slot] };
+    proj.radius = radius[slot];
+    proj.kind = kind[slot];
+    proj.damage = damage[slot];
+    proj.owner = owner[slot];
+    proj.alive = alive[slot] != 0;
+    proj.age = age[slot];
+    proj.fuseTime = fuseTime[slot];
+    proj.bouncesRemaining = bouncesRemaining[slot];
+    return proj;
+}
+
+void advanceProjectileAges(ProjectileStore& store, float dt, ProjectileIndexList& fused) {
+    fused.clear();
+    float* age = store.age.data();
+    const float* fuse = store.fuseTime.data();
+    const simd::Float step = simd::splat(dt);
+
+    const std::size_t count = paddedSpan(store);
+    for (std::size_t i = 0; i < count; i += simd::WIDTH) {
+        simd::Float a = simd::load(age + i) + step;
+        simd::store(age + i, a);
+        appendLanes(fused, i, simd::bits(a >= simd::load(fuse + i)));
+    }
+}
+
+void integrateProjectiles(ProjectileStore& store, float gravity, float dt) {
+    float* px = store.posX.data();
+    float* py = store.posY.data();
+    float* startX = store.prevX.data();
+    float* startY = store.prevY.data();
+    const float* vx = store.velX.data();
+    float* vy = store.velY.data();
+    const simd::Float step = simd::splat(dt);
+    const simd::Float fall = simd::splat(gravity * dt);
+
+    const std::size_t count = paddedSpan(store);
+    for (std::size_t i = 0; i < count; i += simd::WIDTH) {
+        simd::Float x = simd::load(px + i);
+        simd::Float y = simd::load(py + i);
+        simd::store(startX + i, x);
+        simd::store(startY + i, y);
+        simd::Float velocityY = simd::load(vy + i) + fall;
+        simd::store(vy + i, velocityY);
+        simd::store(px + i, x + simd::load(vx + i) * step);
+        simd::store(py + i, y + velocityY * step);
+    }
+}
+
+void findBoundaryContacts(const ProjectileStore& store, float width, float height, ProjectileIndexList& contacts) {
+    contacts.clear();
+    const float* px = store.posX.data();
+    const float* py = store.posY.data();
+    const float* pr = store.radius.data();
+    const simd::Float zero = simd::splat(0.0f);
+    const simd::Float right = simd::splat(width);
+    const simd::Float bottom = simd::splat(height);
+
+    const std::size_t count = paddedSpan(store);
+    for (std::size_t i = 0; i < count; i += simd::WIDTH) {
+        simd::Float x = simd::load(px + i);
+        simd::Float y = simd::load(py + i);
+        simd::Float r = simd::load(pr + i);
+        simd::Mask outside = (x - r <= zero) | (x + r >= right) | (y - r > bottom) | (y + r <= zero);
+        appendLanes(contacts, i, simd::bits(outside));
+    }
+}
+
+} // namespace tankduel
@@ -0,0 +1,106 @@
+// src/core/projectile_store.h
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "constants.h"
+#include "fixed_vector.h"
+#include "math.h"
+
+namespace tankduel {
+
+enum class ProjectileKind { Mortar, Cluster, ClusterShard, Napalm, Grenade, Dirtgun };
+
+// Age at which a projectile's kind-specific event fires; never for most kinds
+constexpr float NO_FUSE = std::numeric_limits<float>::infinity();
+
+// One projectile as a value, used when spawning and for one-off inspection.
+struct Projectile {
+    Vec2 position{};
+    Vec2 velocity{};
+    float radius{RADIUS_MORTAR};
+    ProjectileKind kind{};
+    int damage{};
+    int owner{};
+    bool alive{true};
+    float age{0.0f};
+    float fuseTime{NO_FUSE};
+    int bouncesRemaining{0};
+};
+
+// Names one pooled projectile; goes stale once that projectile is released,
+// even if its slot has been reused since.
+struct ProjectileHandle {
+    static constexpr std::uint32_t INVALID_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t slot{INVALID_SLOT};
+    std::uint32_t generation{0};
+
+    bool valid() const { return slot != INVALID_SLOT; }
+};
+
+using ProjectileIndexList = FixedVector<std::uint32_t, MAX_PROJECTILES>;
+
+// Fixed-capacity structure-of-arrays projectile pool. Slots are recycled
+// through a free list, so spawning never allocates and the whole pool copies
+// as one block. Dead slots keep alive == 0; loops scan [0, span()).
+class ProjectileStore {
+public:
+    template <typename T>
+    using Column = std::array<T, MAX_PROJECTILES>;
+
+    ProjectileStore() { clear(); }
+
+    Column<float> posX{};
+    Column<float> posY{};
+    // Position at the start of the last step, for swept collision
+    Column<float> prevX{};
+    Column<float> prevY{};
+    Column<float> velX{};
+    Column<float> velY{};
+    Column<float> radius{};
+    Column<float> age{};
+    Column<float> fuseTime{};
+    Column<ProjectileKind> kind{};
+    Column<int> damage{};
+    Column<int> owner{};
+    Column<int> bouncesRemaining{};
+    Column<std::uint8_t> alive{};
+    Column<std::uint32_t> generation{};
+
+    static constexpr std::size_t capacity() { return MAX_PROJECTILES; }
+    std::size_t size() const { return liveCount_; }
+    bool empty() const { return liveCount_ == 0; }
+    bool full() const { return freeCount_ == 0; }
+    // One past the highest live slot
+    std::size_t span() const { return span_; }
+    Vec2 position(std::size_t slot) const { return Vec2{ posX[slot], posY[slot] }; }
+
+    void clear();
+    // Becomes a copy of `other` touching only the slots either store has
+    // spanned, so cloning a pool with a few live projectiles is cheap.
+    // Generations past those slots are not carried over.
+    void copyLiveFrom(const ProjectileStore& other);
+    // Returns an invalid handle when the pool is full
+    ProjectileHandle spawn(const Projectile& proj);
+    void release(std::size_t slot);
+    bool contains(ProjectileHandle handle) const;
+    ProjectileHandle handleAt(std::size_t slot) const;
+    Projectile get(std::size_t slot) const;
+
+private:
+    Column<std::uint16_t> freeSlots_{};
+    std::size_t freeCount_{0};
+    std::size_t span_{0};
+    std::size_t liveCount_{0};
+};
+
+// Kernels over slots [0, span()). Index lists come back in ascending order
+// and may name dead slots for the boundary test; callers check alive.
+void advanceProjectileAges(ProjectileStore& store, float dt, ProjectileIndexList& fused);
+void integrateProjectiles(ProjectileStore& store, float gravity, float dt);
+void findBoundaryContacts(const ProjectileStore& store, float width, float height, ProjectileIndexList& contacts);
+
+} // namespace tankduel
@@ -0,0 +1,20 @@
+// src/core/random.cpp
+#include "random.h"
+
+namespace tankduel {
+
+std::mt19937& rng() {
+    thread_local std::mt19937 engine{ std::random_device{}() };
+    return engine;
+}
+
+void seedRng(std::uint32_t seed) {
+    rng().seed(seed);
+}
+
+float randomFloat(float min, float max) {
+    std::uniform_real_distribution<float> dist(min, max);
+    return dist(rng());
+}
+
+} // namespace tankduel
@@ -0,0 +1,13 @@
+// src/core/random.h
+#pragma once
+#include <cstdint>
+#include <random>
+
+namespace tankduel {
+
+// Each thread owns its engine so headless runners can simulate matches in parallel.
+std::mt19937& rng();
+void seedRng(std::uint32_t seed);
+float randomFloat(float min, float max);
+
+} // namespace tankduel
@@ -0,0 +1,108 @@
+// src/core/rollout.cpp
+#include "rollout.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "profiler.h"
+#include "random.h"
+#include "simulation.h"
+#include "work_stealing_pool.h"
+
+namespace tankduel {
+
+namespace {
+
+constexpr std::array<ProjectileKind, 4> BOT_AMMO{ ProjectileKind::Mortar, ProjectileKind::Cluster,
+                                                  ProjectileKind::Napalm, ProjectileKind::Grenade };
+
+// Nothing left in flight, exploding or burning
+bool shotSettled(const GameState& sim) {
+    return sim.projectiles.empty() && sim.napalmPatches.empty() &&
+           std::all_of(sim.explosions.begin(), sim.explosions.end(),
+                       [](const Explosion& e) { return e.timer <= 0.0f; });
+}
+
+// Fires one shot on a clone of `state` and plays it out with no input
+float rolloutDamage(const GameState& state, int shooterId, ProjectileKind kind, const ShotSolution& aim,
+                    const RolloutSettings& settings, std::uint32_t sampleSeed) {
+    thread_local GameState sim;
+    cloneSimState(sim, state);
+    Tank& gun = shooterId == sim.player1.id ? sim.player1 : sim.player2;
+    Tank& foe = shooterId == sim.player1.id ? sim.player2 : sim.player1;
+
+    // The sample's own stream drives both the aim jitter and the physics
+    const std::mt19937 saved = rng();
+    seedRng(sampleSeed);
+    gun.selected = kind;
+    gun.turretAngleDeg = std::clamp(aim.angle + randomFloat(-settings.angleError, settings.angleError), 0.0f,
+                                    MAX_TURRET_SWING);
+    gun.launchSpeed = std::clamp(aim.power + randomFloat(-settings.powerError, settings.powerError),
+                                 MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+    launchProjectile(sim, spawnProjectile(gun));
+    sim.currentPlayer = gun.id;
+    sim.shotFired = true;
+    sim.waitingForTurnEnd = true;
+    sim.turnEndTimer = 3.0f;
+
+    const int foeHp = foe.hp;
+    const int gunHp = gun.hp;
+    const InputState noInput{};
+    const float dt = 1.0f / static_cast<float>(DEFAULT_TICK_RATE);
+    const int maxTicks = static_cast<int>(ROLLOUT_MAX_SECONDS * DEFAULT_TICK_RATE);
+    for (int tick = 0; tick < maxTicks && !sim.matchOver; ++tick) {
+        stepSimulation(sim, noInput, dt);
+        if (shotSettled(sim)) break;
+    }
+    rng() = saved;
+    return static_cast<float>(foeHp - foe.hp) - static_cast<float>(gunHp - gun.hp);
+}
+
+} // namespace
+
+ShotPlan planShotByRollouts(const GameState& state, const Tank& shooter, const Tank& target, FiringTable& table,
+                            const ShotGrid& grid, const RolloutSettings& settings) {
+    PROFILE_FUNCTION();
+    std::array<ShotSolution, BOT_AMMO.size()> aims{};
+    for (std::size_t k = 0; k < BOT_AMMO.size(); ++k) {
+        aims[k] = table.lookup(state, shooter, target, BOT_AMMO[k], grid);
+    }
+
+    const int samples = std::max(1, settings.samples);
+    std::vector<float> damage(BOT_AMMO.size() * static_cast<std::size_t>(samples), 0.0f);
+    auto runSample = [&](std::size_t index) {
+        const std::size_t k = index / static_cast<std::size_t>(samples);
+        const std::uint32_t sampleSeed = settings.seed ^ (static_cast<std::uint32_t>(index + 1) * 0x9E3779B9u);
+        damage[index] = rolloutDamage(state, shooter.id, BOT_AMMO[k], aims[k], settings, sampleSeed);
+    };
+    if (settings.pool) {
+        for (std::size_t i = 0; i < damage.size(); ++i) {
+            settings.pool->submit([&runSample, i] { runSample(i); });
+        }
+        settings.pool->wait();
+    } else {
+        for (std::size_t i = 0; i < damage.size(); ++i) {
+            runSample(i);
+        }
+    }
+
+    ShotPlan best;
+    best.expectedDamage = -static_cast<float>(TANK_HP) * 2.0f;
+    for (std::size_t k = 0; k < BOT_AMMO.size(); ++k) {
+        float total = 0.0f;
+        for (int i = 0; i < samples; ++i) {
+            total += damage[k * static_cast<std::size_t>(samples) + static_cast<std::size_t>(i)];
+        }
+        const float expected = total / static_cast<float>(samples);
+        if (expected > best.expectedDamage) {
+            best.kind = BOT_AMMO[k];
+            best.aim = aims[k];
+            best.expectedDamage = expected;
+        }
+    }
+    return best;
+}
+
+} // namespace tankduel
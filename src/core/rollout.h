@@ -0,0 +1,38 @@
+// src/core/rollout.h
+#pragma once
+#include <cstdint>
+
+#include "firing_table.h"
+#include "game_state.h"
+
+namespace tankduel {
+
+class WorkStealingPool;
+
+// A rollout stops once the shot's effects settle, or after this long
+constexpr float ROLLOUT_MAX_SECONDS = 8.0f;
+
+struct RolloutSettings {
+    int samples{8};          // shots per ammo kind
+    float angleError{0.0f};  // each sample's aim is jittered uniformly by up to these
+    float powerError{0.0f};
+    std::uint32_t seed{0};
+    WorkStealingPool* pool{nullptr};  // runs serially on the calling thread when null
+};
+
+// Ammo and aim for a turn, with what the rollouts expect it to do
+struct ShotPlan {
+    ProjectileKind kind{ProjectileKind::Mortar};
+    ShotSolution aim{};
+    float expectedDamage{0.0f};  // mean damage to the target minus damage to the shooter
+};
+
+// Aims each bot ammo kind through `table`, then plays `samples` jittered
+// shots of each through stepSimulation on cloned states until their effects
+// settle, so cluster splits, bounces, napalm burns and force fields all
+// count. Returns the kind with the best expected damage. Every sample seeds
+// its own generator from `seed`, so the answer does not depend on the pool.
+ShotPlan planShotByRollouts(const GameState& state, const Tank& shooter, const Tank& target, FiringTable& table,
+                            const ShotGrid& grid, const RolloutSettings& settings);
+
+} // namespace tankduel
@@ -0,0 +1,278 @@
+// src/core/shot_solver.cpp
+#include "shot_solver.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "game_state.h"
+#include "profiler.h"
+#include "simd.h"
+#include "simulation.h"
+
+namespace tankduel {
+
+namespace {
+
+constexpr float SOLVER_DT = 1.0f / static_cast<float>(DEFAULT_TICK_RATE);
+constexpr int SOLVER_MAX_STEPS = 10 * DEFAULT_TICK_RATE;
+constexpr float MISS_PENALTY = 1.0e4f;  // any hit outranks every miss
+constexpr float NO_IMPACT = 1.0e6f;     // left the screen or landed on the shooter
+constexpr float SELF_SPLASH_RADIUS = 40.0f;
+
+using detail::CandidateBatch;
+using detail::SolverBox;
+using detail::SolverScene;
+
+void addCandidate(CandidateBatch& batch, const Tank& shooter, ProjectileKind kind, float angle, float power) {
+    Tank launcher = shooter;
+    launcher.selected = kind;
+    launcher.turretAngleDeg = angle;
+    launcher.launchSpeed = power;
+    const Projectile proj = spawnProjectile(launcher);
+    batch.angle.push_back(angle);
+    batch.power.push_back(power);
+    batch.posX.push_back(proj.position.x);
+    batch.posY.push_back(proj.position.y);
+    batch.velX.push_back(proj.velocity.x);
+    batch.velY.push_back(proj.velocity.y);
+}
+
+// Pads to whole vectors with copies of the last candidate and sizes the scores
+void padBatch(CandidateBatch& batch) {
+    while (batch.angle.size() % simd::WIDTH != 0) {
+        batch.angle.push_back(batch.angle.back());
+        batch.power.push_back(batch.power.back());
+        batch.posX.push_back(batch.posX.back());
+        batch.posY.push_back(batch.posY.back());
+        batch.velX.push_back(batch.velX.back());
+        batch.velY.push_back(batch.velY.back());
+    }
+    batch.score.assign(batch.angle.size(), NO_IMPACT);
+    batch.endX = batch.posX;
+}
+
+simd::Mask insideBox(simd::Float x, simd::Float y, const SolverBox& box) {
+    return (x >= simd::splat(box.left)) & (x <= simd::splat(box.right)) & (y >= simd::splat(box.top)) &
+           (y <= simd::splat(box.bottom));
+}
+
+// Integrates simd::WIDTH candidates from `first` until every lane has hit
+// something or left the screen, writing each lane's score.
+void flyLanes(CandidateBatch& batch, size_t first, const SolverScene& scene) {
+    simd::Float x = simd::load(&batch.posX[first]);
+    simd::Float y = simd::load(&batch.posY[first]);
+    const simd::Float vx = simd::load(&batch.velX[first]);
+    simd::Float vy = simd::load(&batch.velY[first]);
+    const simd::Float step = simd::splat(SOLVER_DT);
+    const simd::Float fall = simd::splat(GRAVITY * SOLVER_DT);
+    const simd::Float radius = simd::splat(scene.radius);
+    const simd::Float left = simd::splat(0.0f);
+    const simd::Float right = simd::splat(static_cast<float>(LOGICAL_WIDTH));
+    const simd::Float floor = simd::splat(static_cast<float>(LOGICAL_HEIGHT));
+    const simd::Float groundTop = simd::splat(scene.groundTop);
+    const simd::Float towerTop = simd::splat(scene.towerTop);
+    const std::vector<int>& heights = *scene.heights;
+
+    const int allLanes = (1 << simd::WIDTH) - 1;
+    int active = allLanes;
+    alignas(32) std::array<float, simd::WIDTH> laneX{};
+    alignas(32) std::array<float, simd::WIDTH> laneY{};
+    alignas(32) std::array<float, simd::WIDTH> ground{};
+
+    for (int steps = 0; steps < SOLVER_MAX_STEPS && active; ++steps) {
+        // Same semi-implicit step as integrateProjectiles
+        vy = vy + fall;
+        x = x + vx * step;
+        y = y + vy * step;
+        simd::store(laneX.data(), x);
+        simd::store(laneY.data(), y);
+
+        // Heightfield gather, interpolated like terrainHeightAt, only once a
+        // lane is low enough to reach the highest ground
+        int blockedBits = 0;
+        if (simd::bits(y >= groundTop) & active) {
+            for (int lane = 0; lane < simd::WIDTH; ++lane) {
+                const float column = std::clamp(laneX[lane], 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
+                const int x0 = static_cast<int>(column);
+                const int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
+                const float h0 = static_cast<float>(heights[x0]);
+                ground[lane] = h0 + (static_cast<float>(heights[x1]) - h0) * (column - static_cast<float>(x0));
+            }
+            blockedBits = simd::bits(y + radius >= simd::load(ground.data()));
+        }
+        if (!scene.towers.empty() && (simd::bits(y >= towerTop) & active)) {
+            simd::Mask blocked = insideBox(x, y, scene.towers[0]);
+            for (size_t i = 1; i < scene.towers.size(); ++i) {
+                blocked = blocked | insideBox(x, y, scene.towers[i]);
+            }
+            blockedBits |= simd::bits(blocked);
+        }
+        blockedBits &= active;
+        const int hitBits = simd::bits(insideBox(x, y, scene.target)) & active & ~blockedBits;
+        const simd::Mask offscreen = (x - radius <= left) | (x + radius >= right) | (y + radius <= left) |
+                                     (y - radius > floor);
+        const int goneBits = simd::bits(offscreen) & active & ~blockedBits & ~hitBits;
+
+        if (blockedBits | hitBits | goneBits) {
+            for (int lane = 0; lane < simd::WIDTH; ++lane) {
+                const int bit = 1 << lane;
+                if (!(active & bit)) continue;
+                const float dx = laneX[lane] - scene.targetX;
+                const float dy = laneY[lane] - scene.targetY;
+                const float distance = std::sqrt(dx * dx + dy * dy);
+                if (hitBits & bit) {
+                    batch.score[first + lane] = distance;
+                } else if (blockedBits & bit) {
+                    const float sx = laneX[lane] - scene.shooterX;
+                    const float sy = laneY[lane] - scene.shooterY;
+                    const bool selfSplash = sx * sx + sy * sy < SELF_SPLASH_RADIUS * SELF_SPLASH_RADIUS;
+                    batch.score[first + lane] = selfSplash ? NO_IMPACT : MISS_PENALTY + distance;
+                } else if (goneBits & bit) {
+                    batch.score[first + lane] = NO_IMPACT;
+                } else {
+                    continue;
+                }
+                batch.endX[first + lane] = laneX[lane];
+                active &= ~bit;
+            }
+        }
+    }
+}
+
+size_t bestCandidate(const CandidateBatch& batch) {
+    return static_cast<size_t>(std::min_element(batch.score.begin(), batch.score.end()) - batch.score.begin());
+}
+
+ShotSolution solutionAt(const CandidateBatch& batch, size_t index, float radius) {
+    ShotSolution solution;
+    solution.angle = batch.angle[index];
+    solution.power = batch.power[index];
+    solution.hits = batch.score[index] < MISS_PENALTY;
+    solution.missDistance = solution.hits ? 0.0f : batch.score[index] - MISS_PENALTY;
+    const float fromX = std::min(batch.posX[index], batch.endX[index]) - radius;
+    const float toX = std::max(batch.posX[index], batch.endX[index]) + radius;
+    solution.arc = ColumnRange{ std::max(0, static_cast<int>(std::floor(fromX))),
+                                std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::floor(toX)) + 1) };
+    return solution;
+}
+
+float gridValue(float min, float max, int steps, int index) {
+    return steps > 1 ? min + (max - min) * static_cast<float>(index) / static_cast<float>(steps - 1) : (min + max) * 0.5f;
+}
+
+void fillGrid(CandidateBatch& batch, const Tank& shooter, ProjectileKind kind, float minAngle, float maxAngle,
+              int angleSteps, float minPower, float maxPower, int powerSteps) {
+    batch = CandidateBatch{};
+    // Power-major, so neighbouring lanes fly for similar times
+    for (int p = 0; p < powerSteps; ++p) {
+        const float power = gridValue(minPower, maxPower, powerSteps, p);
+        for (int a = 0; a < angleSteps; ++a) {
+            addCandidate(batch, shooter, kind, gridValue(minAngle, maxAngle, angleSteps, a), power);
+        }
+    }
+    padBatch(batch);
+}
+
+std::uint64_t searchClockNs() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+void ShotSearch::begin(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                       const ShotGrid& grid) {
+    shooter_ = &shooter;
+    kind_ = kind;
+    grid_ = grid;
+    grid_.angleSteps = std::max(1, grid.angleSteps);
+    grid_.powerSteps = std::max(1, grid.powerSteps);
+    next_ = 0;
+    round_ = 0;
+    bestScore_ = std::numeric_limits<float>::infinity();
+    best_ = ShotSolution{};
+    finished_ = state.terrain.heights.empty();
+    if (finished_) return;
+
+    scene_ = SolverScene{};
+    scene_.heights = &state.terrain.heights;
+    {
+        Tank probe = shooter;
+        probe.selected = kind;
+        scene_.radius = spawnProjectile(probe).radius;
+    }
+    const Rect hitbox = tankHitbox(target);
+    scene_.target = SolverBox{ hitbox.x - scene_.radius, hitbox.y - scene_.radius,
+                               hitbox.x + hitbox.w + scene_.radius, hitbox.y + hitbox.h + scene_.radius };
+    scene_.targetX = hitbox.x + hitbox.w * 0.5f;
+    scene_.targetY = hitbox.y + hitbox.h * 0.5f;
+    scene_.shooterX = shooter.rect.x + shooter.rect.w * 0.5f;
+    scene_.shooterY = shooter.rect.y + shooter.rect.h * 0.5f;
+    scene_.groundTop = static_cast<float>(*std::min_element(state.terrain.heights.begin(), state.terrain.heights.end())) -
+                       scene_.radius;
+    scene_.towerTop = static_cast<float>(LOGICAL_HEIGHT);
+    for (const SceneryObject& object : state.scenery) {
+        if (!object.alive || scene_.towers.full()) continue;
+        const SolverBox tower{ object.rect.x - scene_.radius, object.rect.y - scene_.radius,
+                               object.rect.x + object.rect.w + scene_.radius,
+                               object.rect.y + object.rect.h + scene_.radius };
+        scene_.towers.push_back(tower);
+        scene_.towerTop = std::min(scene_.towerTop, tower.top);
+    }
+
+    angleCell_ = grid_.angleSteps > 1 ? (grid_.maxAngle - grid_.minAngle) / static_cast<float>(grid_.angleSteps - 1) : 0.0f;
+    powerCell_ = grid_.powerSteps > 1 ? (grid_.maxPower - grid_.minPower) / static_cast<float>(grid_.powerSteps - 1) : 0.0f;
+    fillGrid(batch_, shooter, kind, grid_.minAngle, grid_.maxAngle, grid_.angleSteps, grid_.minPower, grid_.maxPower,
+             grid_.powerSteps);
+}
+
+bool ShotSearch::step(std::uint64_t budgetNs) {
+    PROFILE_FUNCTION();
+    const std::uint64_t deadline = budgetNs == SHOT_SEARCH_UNBOUNDED ? 0 : searchClockNs() + budgetNs;
+    while (!finished_) {
+        flyLanes(batch_, next_, scene_);
+        next_ += simd::WIDTH;
+        if (next_ == batch_.angle.size()) finishPass();
+        if (deadline != 0 && searchClockNs() >= deadline) break;
+    }
+    return finished_;
+}
+
+// Keeps the pass's winner if it beats the best so far, then lays out the
+// next round one cell either side of the best
+void ShotSearch::finishPass() {
+    const size_t index = bestCandidate(batch_);
+    if (batch_.score[index] <= bestScore_) {
+        bestScore_ = batch_.score[index];
+        best_ = solutionAt(batch_, index, scene_.radius);
+    }
+    ++round_;
+    next_ = 0;
+    if (round_ > grid_.refineRounds || grid_.refineSteps < 2) {
+        finished_ = true;
+        return;
+    }
+    const float spread = 2.0f / static_cast<float>(grid_.refineSteps - 1);
+    fillGrid(batch_, *shooter_, kind_,
+             std::max(grid_.minAngle, best_.angle - angleCell_), std::min(grid_.maxAngle, best_.angle + angleCell_),
+             grid_.refineSteps,
+             std::max(grid_.minPower, best_.power - powerCell_), std::min(grid_.maxPower, best_.power + powerCell_),
+             grid_.refineSteps);
+    angleCell_ *= spread;
+    powerCell_ *= spread;
+}
+
+ShotSolution solveShot(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                       const ShotGrid& grid) {
+    PROFILE_FUNCTION();
+    ShotSearch search;
+    search.begin(state, shooter, target, kind, grid);
+    search.step(SHOT_SEARCH_UNBOUNDED);
+    return search.best();
+}
+
+} // namespace tankduel
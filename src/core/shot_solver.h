@@ -0,0 +1,121 @@
+// src/core/shot_solver.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "constants.h"
+#include "fixed_vector.h"
+#include "math.h"
+#include "projectile_store.h"
+#include "terrain_pyramid.h"
+
+namespace tankduel {
+
+struct GameState;
+struct Tank;
+
+// Turret angle (tank-relative, as Tank::turretAngleDeg) and launch speed of a
+// candidate shot, with where the integrated flight ended.
+struct ShotSolution {
+    float angle{45.0f};
+    float power{DEFAULT_LAUNCH_SPEED};
+    bool hits{false};          // strikes the target hitbox before terrain or towers
+    float missDistance{0.0f};  // impact point to target centre; 0 when it hits
+    ColumnRange arc{};         // columns the flight passes over, radius included
+};
+
+// Candidate grid of the coarse pass; the best cell is then refined with a
+// finer grid spanning one cell either side, refineRounds times over.
+struct ShotGrid {
+    int angleSteps{32};
+    int powerSteps{16};
+    float minAngle{0.0f};
+    float maxAngle{MAX_TURRET_SWING};
+    float minPower{MIN_LAUNCH_SPEED};
+    float maxPower{MAX_LAUNCH_SPEED};
+    int refineSteps{8};
+    int refineRounds{1};
+
+    bool operator==(const ShotGrid& other) const {
+        return angleSteps == other.angleSteps && powerSteps == other.powerSteps && minAngle == other.minAngle &&
+               maxAngle == other.maxAngle && minPower == other.minPower && maxPower == other.maxPower &&
+               refineSteps == other.refineSteps && refineRounds == other.refineRounds;
+    }
+};
+
+// Budget for ShotSearch::step that never runs out
+constexpr std::uint64_t SHOT_SEARCH_UNBOUNDED = ~std::uint64_t{0};
+
+namespace detail {
+
+struct SolverBox {
+    float left, top, right, bottom;
+};
+
+// Everything a lane tests against, widened by the projectile radius once
+struct SolverScene {
+    const std::vector<int>* heights{nullptr};
+    float radius{0.0f};
+    SolverBox target{};
+    float targetX{0.0f};
+    float targetY{0.0f};
+    float shooterX{0.0f};
+    float shooterY{0.0f};
+    float groundTop{0.0f};  // highest ground anywhere, minus the radius
+    float towerTop{0.0f};   // highest widened tower top
+    FixedVector<SolverBox, MAX_SCENERY_OBJECTS> towers{};
+};
+
+// One pass of candidates as structure-of-arrays, padded to whole vectors
+struct CandidateBatch {
+    std::vector<float> angle;
+    std::vector<float> power;
+    std::vector<float> posX, posY, velX, velY;
+    std::vector<float> score;
+    std::vector<float> endX;  // where each flight stopped
+};
+
+} // namespace detail
+
+// solveShot as a resumable task for callers with a per-frame CPU budget.
+// Reads the terrain heights and the shooter in place, so both must outlive
+// the search and a terrain edit calls for a new begin().
+class ShotSearch {
+public:
+    void begin(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+               const ShotGrid& grid = ShotGrid{});
+    // Flies candidates until roughly `budgetNs` has passed; true once the
+    // last refinement round is done.
+    bool step(std::uint64_t budgetNs);
+
+    bool finished() const { return finished_; }
+    // True once the coarse pass is done and best() is worth firing
+    bool hasSolution() const { return round_ > 0; }
+    const ShotSolution& best() const { return best_; }
+
+private:
+    void finishPass();
+
+    detail::SolverScene scene_{};
+    detail::CandidateBatch batch_{};
+    const Tank* shooter_{nullptr};
+    ProjectileKind kind_{ProjectileKind::Mortar};
+    ShotGrid grid_{};
+    float angleCell_{0.0f};  // candidate spacing of the pass in flight
+    float powerCell_{0.0f};
+    std::size_t next_{0};    // first candidate not yet flown
+    int round_{0};           // passes completed, coarse included
+    bool finished_{true};
+    float bestScore_{0.0f};
+    ShotSolution best_{};
+};
+
+// Flies every (angle, power) candidate of the grid for `kind` in SIMD lanes,
+// with the launch point, speed and gravity step the real projectile uses,
+// against the heightfield, live towers and the target hitbox. Prefers hits
+// closest to the hitbox centre, then the nearest miss.
+ShotSolution solveShot(const GameState& state, const Tank& shooter, const Tank& target, ProjectileKind kind,
+                       const ShotGrid& grid = ShotGrid{});
+
+} // namespace tankduel
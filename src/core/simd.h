@@ -0,0 +1,97 @@
+// src/core/simd.h
+// Thin wrapper over the widest float vector the build targets: AVX2 (8 lanes)
+// when compiled with -mavx2 (TANK_DUEL_ENABLE_AVX2), SSE2 (4 lanes) on any
+// x86-64 build, and a one-lane scalar fallback elsewhere. Kernels are written
+// once against these helpers and loop in steps of simd::WIDTH.
+#pragma once
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TANK_DUEL_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TANK_DUEL_SIMD_SSE2 1
+#endif
+
+namespace tankduel {
+namespace simd {
+
+#if defined(TANK_DUEL_SIMD_AVX2)
+
+constexpr int WIDTH = 8;
+constexpr const char* NAME = "avx2";
+
+struct Float { __m256 v; };
+struct Mask { __m256 v; };
+
+inline Float load(const float* p) { return { _mm256_loadu_ps(p) }; }
+inline void store(float* p, Float a) { _mm256_storeu_ps(p, a.v); }
+inline Float splat(float x) { return { _mm256_set1_ps(x) }; }
+inline Float operator+(Float a, Float b) { return { _mm256_add_ps(a.v, b.v) }; }
+inline Float operator-(Float a, Float b) { return { _mm256_sub_ps(a.v, b.v) }; }
+inline Float operator*(Float a, Float b) { return { _mm256_mul_ps(a.v, b.v) }; }
+inline Float min(Float a, Float b) { return { _mm256_min_ps(a.v, b.v) }; }
+inline Float max(Float a, Float b) { return { _mm256_max_ps(a.v, b.v) }; }
+inline Mask operator<(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+inline Mask operator<=(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+inline Mask operator>(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+inline Mask operator>=(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+inline Mask operator|(Mask a, Mask b) { return { _mm256_or_ps(a.v, b.v) }; }
+inline Mask operator&(Mask a, Mask b) { return { _mm256_and_ps(a.v, b.v) }; }
+inline Float select(Mask m, Float a, Float b) { return { _mm256_blendv_ps(b.v, a.v, m.v) }; }
+inline int bits(Mask m) { return _mm256_movemask_ps(m.v); }
+
+#elif defined(TANK_DUEL_SIMD_SSE2)
+
+constexpr int WIDTH = 4;
+constexpr const char* NAME = "sse2";
+
+struct Float { __m128 v; };
+struct Mask { __m128 v; };
+
+inline Float load(const float* p) { return { _mm_loadu_ps(p) }; }
+inline void store(float* p, Float a) { _mm_storeu_ps(p, a.v); }
+inline Float splat(float x) { return { _mm_set1_ps(x) }; }
+inline Float operator+(Float a, Float b) { return { _mm_add_ps(a.v, b.v) }; }
+inline Float operator-(Float a, Float b) { return { _mm_sub_ps(a.v, b.v) }; }
+inline Float operator*(Float a, Float b) { return { _mm_mul_ps(a.v, b.v) }; }
+inline Float min(Float a, Float b) { return { _mm_min_ps(a.v, b.v) }; }
+inline Float max(Float a, Float b) { return { _mm_max_ps(a.v, b.v) }; }
+inline Mask operator<(Float a, Float b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+inline Mask operator<=(Float a, Float b) { return { _mm_cmple_ps(a.v, b.v) }; }
+inline Mask operator>(Float a, Float b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+inline Mask operator>=(Float a, Float b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+inline Mask operator|(Mask a, Mask b) { return { _mm_or_ps(a.v, b.v) }; }
+inline Mask operator&(Mask a, Mask b) { return { _mm_and_ps(a.v, b.v) }; }
+inline Float select(Mask m, Float a, Float b) { return { _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)) }; }
+inline int bits(Mask m) { return _mm_movemask_ps(m.v); }
+
+#else
+
+constexpr int WIDTH = 1;
+constexpr const char* NAME = "scalar";
+
+struct Float { float v; };
+struct Mask { bool v; };
+
+inline Float load(const float* p) { return { *p }; }
+inline void store(float* p, Float a) { *p = a.v; }
+inline Float splat(float x) { return { x }; }
+inline Float operator+(Float a, Float b) { return { a.v + b.v }; }
+inline Float operator-(Float a, Float b) { return { a.v - b.v }; }
+inline Float operator*(Float a, Float b) { return { a.v * b.v }; }
+inline Float min(Float a, Float b) { return { a.v < b.v ? a.v : b.v }; }
+inline Float max(Float a, Float b) { return { a.v > b.v ? a.v : b.v }; }
+inline Mask operator<(Float a, Float b) { return { a.v < b.v }; }
+inline Mask operator<=(Float a, Float b) { return { a.v <= b.v }; }
+inline Mask operator>(Float a, Float b) { return { a.v > b.v }; }
+inline Mask operator>=(Float a, Float b) { return { a.v >= b.v }; }
+inline Mask operator|(Mask a, Mask b) { return { a.v || b.v }; }
+inline Mask operator&(Mask a, Mask b) { return { a.v && b.v }; }
+inline Float select(Mask m, Float a, Float b) { return m.v ? a : b; }
+inline int bits(Mask m) { return m.v ? 1 : 0; }
+
+#endif
+
+} // namespace simd
+} // namespace tankduel
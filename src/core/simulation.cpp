@@ -0,0 +1,965 @@
+// src/core/simulation.cpp
+#include "simulation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "bot.h"
+#include "profiler.h"
+#include "random.h"
+#include "terrain.h"
+
+namespace tankduel {
+
+namespace {
+
+float sceneryMaxHealth(SceneryKind kind) {
+    (void)kind;
+    return 120.0f;
+}
+
+ColliderRef sceneryCollider(const GameState& state, const SceneryObject& object) {
+    return ColliderRef{ ColliderKind::Scenery, static_cast<std::uint16_t>(&object - state.scenery.data()) };
+}
+
+void destroySceneryObject(GameState& state, SceneryObject& object, const Vec2& impact) {
+    if (!object.alive) return;
+    object.alive = false;
+    state.broadphase.remove(sceneryCollider(state, object));
+    float radius = 26.0f;
+    float depth = 14.0f;
+    erodeTerrainLayers(state, object.rect.x + object.rect.w * 0.5f, radius, depth);
+    state.explosions.push_back({ impact, 0.5f, 0.5f, radius + 6.0f, false });
+}
+
+float clampPosition(float value, float halfWidth) {
+    return std::clamp(value, halfWidth + 4.0f, static_cast<float>(LOGICAL_WIDTH) - halfWidth - 4.0f);
+}
+
+void addSceneryObject(GameState& state, SceneryKind kind, float centerX) {
+    if (state.scenery.size() >= MAX_SCENERY_OBJECTS) return;
+
+    float width = randomFloat(20.0f, 28.0f);
+    float height = randomFloat(78.0f, 108.0f);
+
+    float halfWidth = width * 0.5f;
+    float clampedCenter = clampPosition(centerX, halfWidth);
+    float left = clampedCenter - halfWidth;
+    float groundLeft = terrainHeightAt(state.terrain.heights, left);
+    float groundRight = terrainHeightAt(state.terrain.heights, left + width);
+    float support = std::min(groundLeft, groundRight);
+    float top = support - height;
+
+    SceneryObject object;
+    object.rect = Rect{ left, top, width, height };
+    object.kind = kind;
+    object.maxHealth = sceneryMaxHealth(kind);
+    object.health = object.maxHealth;
+    object.alive = true;
+    object.verticalVelocity = 0.0f;
+    object.falling = false;
+    state.scenery.push_back(object);
+    state.broadphase.place(sceneryCollider(state, state.scenery.back()), left, left + width);
+}
+
+// Tanks only move vertically, so this rebuckets just when a force field
+// comes or goes
+void syncTankColliders(GameState& state) {
+    const Tank* tanks[2] = { &state.player1, &state.player2 };
+    for (std::uint16_t i = 0; i < 2; ++i) {
+        const Tank& tank = *tanks[i];
+        Rect hitbox = tankHitbox(tank);
+        state.broadphase.place(ColliderRef{ ColliderKind::Tank, i }, hitbox.x, hitbox.x + hitbox.w);
+
+        const ColliderRef field{ ColliderKind::ForceField, i };
+        if (tank.forceFieldActive) {
+            float centerX = tank.rect.x + tank.rect.w * 0.5f;
+            state.broadphase.place(field, centerX - tank.forceFieldRadius, centerX + tank.forceFieldRadius);
+        } else {
+            state.broadphase.remove(field);
+        }
+    }
+}
+
+// Per-thread scratch for updateProjectiles, fixed size so ticks never allocate
+ProjectileIndexList& scratchIndices() {
+    thread_local ProjectileIndexList indices;
+    return indices;
+}
+
+ColliderList& nearbyColliders() {
+    thread_local ColliderList colliders;
+    return colliders;
+}
+
+FixedVector<Projectile, MAX_PROJECTILES>& pendingShards() {
+    thread_local FixedVector<Projectile, MAX_PROJECTILES> shards;
+    return shards;
+}
+
+// Grenades bounce off the left, right and top edges while they have bounces
+// left; everything else leaving the screen is removed
+void resolveScreenEdges(ProjectileStore& store, std::size_t i) {
+    const bool bounces = store.kind[i] == ProjectileKind::Grenade;
+    float& x = store.posX[i];
+    float& y = store.posY[i];
+    const float radius = store.radius[i];
+    int& bouncesRemaining = store.bouncesRemaining[i];
+
+    if (x - radius <= 0.0f) {
+        if (bounces && bouncesRemaining > 0) {
+            x = radius + 1.0f;
+            store.velX[i] = -store.velX[i] * 0.6f;
+            bouncesRemaining--;
+        } else {
+            store.release(i);
+            return;
+        }
+    }
+    if (x + radius >= LOGICAL_WIDTH) {
+        if (bounces && bouncesRemaining > 0) {
+            x = LOGICAL_WIDTH - radius - 1.0f;
+            store.velX[i] = -store.velX[i] * 0.6f;
+            bouncesRemaining--;
+        } else {
+            store.release(i);
+            return;
+        }
+    }
+    if (y - radius > LOGICAL_HEIGHT) {
+        store.release(i);
+        return;
+    }
+    // Handle top boundary bounce
+    if (y + radius <= 0.0f) {
+        if (bounces && bouncesRemaining > 0) {
+            y = -radius + 1.0f;
+            store.velY[i] = -store.velY[i] * 0.6f;
+            bouncesRemaining--;
+        } else {
+            store.release(i);
+        }
+    }
+}
+
+// Shards are queued and spawned once the tick's projectiles have all moved
+void splitClusterProjectile(GameState& state, std::size_t index) {
+    ProjectileStore& store = state.projectiles;
+    const Vec2 position = store.position(index);
+    const float velocityX = store.velX[index];
+    const float velocityY = store.velY[index];
+    const int owner = store.owner[index];
+
+    float speedMag = std::sqrt(velocityX * velocityX + velocityY * velocityY);
+    float baseAngle = std::atan2(velocityY, velocityX);
+    for (int i = -1; i <= 1; ++i) {
+        float spread = CLUSTER_SPREAD * static_cast<float>(i);
+        float newAngle = baseAngle + spread;
+        float newSpeed = speedMag * randomFloat(0.88f, 1.02f);
+        Projectile shard;
+        shard.kind = ProjectileKind::ClusterShard;
+        shard.owner = owner;
+        shard.damage = DAMAGE_CLUSTER_SHARD;
+        shard.radius = RADIUS_CLUSTER_SHARD;
+        shard.position = position;
+        shard.velocity.x = std::cos(newAngle) * newSpeed;
+        shard.velocity.y = std::sin(newAngle) * newSpeed;
+        pendingShards().push_back(shard);
+    }
+    state.explosions.push_back({position, 0.25f, 0.25f, 14.0f, false});
+    store.release(index);
+}
+
+} // namespace
+
+Rect makeTankRect(float x, float y) {
+    return Rect{ x, y, TANK_COLLISION_WIDTH, TANK_COLLISION_HEIGHT };
+}
+
+float turretWorldAngleDeg(const Tank& tank) {
+    return tank.facingRight ? tank.turretAngleDeg : (180.0f - tank.turretAngleDeg);
+}
+
+Projectile spawnProjectile(const Tank& tank) {
+    Projectile proj;
+    proj.kind = tank.selected;
+    proj.owner = tank.id;
+
+    float speed = tank.launchSpeed;
+    switch (proj.kind) {
+        case ProjectileKind::Mortar:
+            proj.damage = DAMAGE_MORTAR;
+            proj.radius = RADIUS_MORTAR;
+            break;
+        case ProjectileKind::Cluster:
+            proj.damage = DAMAGE_CLUSTER;
+            proj.radius = RADIUS_CLUSTER;
+            proj.fuseTime = CLUSTER_SPLIT_TIME;
+            speed *= 1.05f;
+            break;
+        case ProjectileKind::Napalm:
+            proj.damage = DAMAGE_NAPALM_DIRECT;
+            proj.radius = RADIUS_NAPALM;
+            speed *= 1.1f;
+            break;
+        case ProjectileKind::Grenade:
+            proj.damage = DAMAGE_GRENADE;
+            proj.radius = RADIUS_GRENADE;
+            proj.bouncesRemaining = 3;
+            speed *= 1.0f;
+            break;
+        case ProjectileKind::ClusterShard:
+            proj.damage = DAMAGE_CLUSTER_SHARD;
+            proj.radius = RADIUS_CLUSTER_SHARD;
+            speed *= 0.9f;
+            break;
+        case ProjectileKind::Dirtgun:
+            proj.damage = DAMAGE_DIRTGUN;
+            proj.radius = RADIUS_DIRTGUN;
+            speed *= 1.1f;
+            break;
+    }
+
+    float angleDeg = turretWorldAngleDeg(tank);
+    float angleRad = angleDeg * DEG2RAD;
+    float pivotX = tank.rect.x + tank.rect.w * 0.5f;
+    float pivotY = tank.rect.y + TURRET_PIVOT_WORLD_OFFSET_Y;
+
+    proj.position.x = pivotX + std::cos(angleRad) * MUZZLE_LENGTH;
+    proj.position.y = pivotY - std::sin(angleRad) * MUZZLE_LENGTH;
+    proj.velocity = Vec2{
+        std::cos(angleRad) * speed,
+        -std::sin(angleRad) * speed
+    };
+
+    return proj;
+}
+
+ProjectileHandle launchProjectile(GameState& state, const Projectile& proj) {
+    return state.projectiles.spawn(proj);
+}
+
+void updateTank(Tank& tank, const InputState& input, float dt, bool isCurrentPlayer, GameState& state) {
+    PROFILE_FUNCTION();
+    if (tank.reloadTimer > 0.0f) {
+        tank.reloadTimer -= dt;
+        if (tank.reloadTimer < 0.0f) tank.reloadTimer = 0.0f;
+    }
+
+    // Only allow input if it's this player's turn and not waiting for turn end
+    if (isCurrentPlayer && !state.waitingForTurnEnd) {
+        if (input.isDown(tank.aimUp)) tank.turretAngleDeg += TURRET_ROT_SPEED * dt;
+        if (input.isDown(tank.aimDown)) tank.turretAngleDeg -= TURRET_ROT_SPEED * dt;
+
+        tank.turretAngleDeg = std::clamp(tank.turretAngleDeg, 0.0f, MAX_TURRET_SWING);
+
+        if (input.isDown(tank.powerUp))   tank.launchSpeed += POWER_ADJUST_RATE * dt;
+        if (input.isDown(tank.powerDown)) tank.launchSpeed -= POWER_ADJUST_RATE * dt;
+        tank.launchSpeed = std::clamp(tank.launchSpeed, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+
+        if (input.isDown(tank.nextAmmo)) {
+            if (!tank.ammoSwitchHeld) {
+                tank.selected = nextAmmoType(tank.selected);
+                tank.ammoSwitchHeld = true;
+            }
+        } else {
+            tank.ammoSwitchHeld = false;
+        }
+
+        // Firing logic depends on play mode
+        bool canFire = input.isDown(tank.fire) && tank.reloadTimer <= 0.0f;
+        if (state.playMode == PlayMode::FreeForAll) {
+            // In free-for-all, any player can fire anytime (no turn restrictions)
+            if (canFire) {
+                launchProjectile(state, spawnProjectile(tank));
+                tank.reloadTimer = RELOAD_TIME;
+
+                // Increment shot count and make force field available every 5 shots
+                tank.shotsFired++;
+                if (tank.shotsFired % 5 == 0) {
+                    tank.forceFieldAvailable = true;
+                }
+            }
+        } else {
+            // Turn-based: only allow firing if it's the player's turn and they haven't fired yet
+            if (canFire && !state.shotFired) {
+                launchProjectile(state, spawnProjectile(tank));
+                tank.reloadTimer = RELOAD_TIME;
+                state.shotFired = true;
+                state.waitingForTurnEnd = true;
+                state.turnEndTimer = 3.0f; // Wait 3 seconds to see projectile impact before switching turns
+
+                // Increment shot count and make force field available every 5 shots
+                tank.shotsFired++;
+                if (tank.shotsFired % 5 == 0) {
+                    tank.forceFieldAvailable = true;
+                }
+            }
+        }
+    } else {
+        // Reset ammo switch state for non-active players
+        tank.ammoSwitchHeld = false;
+    }
+
+    // Force field activation is available to all players regardless of turn (for free-for-all mode)
+    if (input.isDown(tank.activateForceField)) {
+        if (!tank.forceFieldKeyHeld && tank.forceFieldAvailable && !tank.forceFieldActive) {
+            tank.forceFieldActive = true;
+            tank.forceFieldAvailable = false;
+            tank.forceFieldKeyHeld = true;
+        }
+    } else {
+        tank.forceFieldKeyHeld = false;
+    }
+}
+
+bool circleIntersectsRect(const Vec2& center, float radius, const Rect& rect) {
+    float closestX = std::clamp(center.x, rect.x, rect.x + rect.w);
+    float closestY = std::clamp(center.y, rect.y, rect.y + rect.h);
+    float dx = center.x - closestX;
+    float dy = center.y - closestY;
+    return (dx * dx + dy * dy) <= radius * radius;
+}
+
+bool sweepCircleRect(const Vec2& from, const Vec2& to, float radius, const Rect& rect, float& toi) {
+    if (circleIntersectsRect(from, radius, rect)) {
+        toi = 0.0f;
+        return true;
+    }
+
+    const float dx = to.x - from.x;
+    const float dy = to.y - from.y;
+    float best = 2.0f;
+
+    // The rect grown by `radius` with rounded corners is two crossed slabs
+    // plus four corner discs; the first contact is the earliest entry of any
+    auto enterBox = [&](float minX, float minY, float maxX, float maxY) {
+        float tEnter = 0.0f;
+        float tExit = 1.0f;
+        const float origin[2] = { from.x, from.y };
+        const float delta[2] = { dx, dy };
+        const float lo[2] = { minX, minY };
+        const float hi[2] = { maxX, maxY };
+        for (int axis = 0; axis < 2; ++axis) {
+            if (delta[axis] == 0.0f) {
+                if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return;
+                continue;
+            }
+            float t0 = (lo[axis] - origin[axis]) / delta[axis];
+            float t1 = (hi[axis] - origin[axis]) / delta[axis];
+            if (t0 > t1) std::swap(t0, t1);
+            tEnter = std::max(tEnter, t0);
+            tExit = std::min(tExit, t1);
+            if (tEnter > tExit) return;
+        }
+        best = std::min(best, tEnter);
+    };
+    auto enterDisc = [&](float cx, float cy) {
+        const float ox = from.x - cx;
+        const float oy = from.y - cy;
+        const float a = dx * dx + dy * dy;
+        const float b = ox * dx + oy * dy;
+        const float c = ox * ox + oy * oy - radius * radius;
+        const float disc = b * b - a * c;
+        if (a == 0.0f || disc < 0.0f) return;
+        const float t = (-b - std::sqrt(disc)) / a;
+        if (t >= 0.0f && t <= 1.0f) best = std::min(best, t);
+    };
+
+    enterBox(rect.x - radius, rect.y, rect.x + rect.w + radius, rect.y + rect.h);
+    enterBox(rect.x, rect.y - radius, rect.x + rect.w, rect.y + rect.h + radius);
+    enterDisc(rect.x, rect.y);
+    enterDisc(rect.x + rect.w, rect.y);
+    enterDisc(rect.x, rect.y + rect.h);
+    enterDisc(rect.x + rect.w, rect.y + rect.h);
+
+    if (best > 1.0f) return false;
+    toi = best;
+    return true;
+}
+
+Rect tankHitbox(const Tank& tank) {
+    Rect hit = tank.rect;
+    float extraWidth = HULL_DRAW_WIDTH * 0.45f;
+    hit.x -= extraWidth * 0.5f;
+    hit.w += extraWidth;
+    float extraTop = TURRET_DRAW_HEIGHT * 0.85f;
+    hit.y -= extraTop;
+    hit.h += extraTop;
+    return hit;
+}
+
+void damageSceneryObject(GameState& state, SceneryObject& object, float amount, const Vec2& impact) {
+    if (!object.alive) return;
+    object.health -= amount;
+    float scarDepth = std::max(2.0f, amount * 0.15f);
+    erodeTerrainLayers(state, impact.x, std::max(object.rect.w * 0.25f, 10.0f), scarDepth);
+    if (object.health <= 0.0f) {
+        destroySceneryObject(state, object, impact);
+    }
+}
+
+void generateSceneryObjects(GameState& state) {
+    state.scenery.clear();
+    state.broadphase.clear();
+    constexpr float MIN_DISTANCE_BETWEEN_TOWERS = 110.0f;
+    constexpr float TANK_CLEAR_ZONE = 110.0f;
+    std::vector<float> selected;
+    std::array<float, 2> tankCenters{
+        56.0f + TANK_COLLISION_WIDTH * 0.5f,
+        static_cast<float>(LOGICAL_WIDTH) - 72.0f + TANK_COLLISION_WIDTH * 0.5f
+    };
+
+    auto isValid = [&](float candidate) {
+        for (float center : tankCenters) {
+            if (std::abs(candidate - center) < TANK_CLEAR_ZONE) return false;
+        }
+        for (float existing : selected) {
+            if (std::abs(candidate - existing) < MIN_DISTANCE_BETWEEN_TOWERS) return false;
+        }
+        return true;
+    };
+
+    const int desiredTowers = 3;
+    for (int i = 0; i < desiredTowers; ++i) {
+        bool placed = false;
+        for (int attempt = 0; attempt < 20 && !placed; ++attempt) {
+            float candidate = randomFloat(80.0f, static_cast<float>(LOGICAL_WIDTH) - 80.0f);
+            if (!isValid(candidate)) continue;
+            selected.push_back(candidate);
+            placed = true;
+        }
+    }
+
+    for (float center : selected) {
+        addSceneryObject(state, SceneryKind::Tower, center);
+    }
+}
+
+void applyGravityToTank(Tank& tank, const std::vector<int>& terrain, float dt) {
+    PROFILE_FUNCTION();
+    constexpr float GRAVITY_ACC = 260.0f;
+    float leftSample = terrainHeightAt(terrain, tank.rect.x + tank.rect.w * 0.25f);
+    float rightSample = terrainHeightAt(terrain, tank.rect.x + tank.rect.w * 0.75f);
+    float support = std::min(leftSample, rightSample);
+    float bottom = tank.rect.y + tank.rect.h;
+
+    float gap = support - bottom;
+    if (gap > 0.5f) {
+        tank.verticalVelocity += GRAVITY_ACC * dt;
+        tank.rect.y += tank.verticalVelocity * dt;
+    } else if (gap < -0.5f) {
+        tank.rect.y = support - tank.rect.h - 0.5f;
+        tank.verticalVelocity = 0.0f;
+    } else {
+        tank.rect.y = support - tank.rect.h;
+        tank.verticalVelocity = 0.0f;
+    }
+
+    float newBottom = tank.rect.y + tank.rect.h;
+    if (newBottom >= support - 0.2f && tank.verticalVelocity > 0.0f && gap <= 0.5f) {
+        tank.rect.y = support - tank.rect.h;
+        tank.verticalVelocity = 0.0f;
+    }
+
+    if (tank.rect.y + tank.rect.h > LOGICAL_HEIGHT - 2) {
+        tank.rect.y = LOGICAL_HEIGHT - 2 - tank.rect.h;
+        tank.verticalVelocity = 0.0f;
+    }
+}
+
+void applyGravityToScenery(SceneryObject& object, const std::vector<int>& terrain, float dt) {
+    PROFILE_FUNCTION();
+    if (!object.alive) return;
+
+    constexpr float GRAVITY_ACC = 260.0f;
+    constexpr float SUPPORT_THRESHOLD = 2.0f;
+
+    // Sample terrain at multiple points under the tower for stability
+    float leftSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.1f);
+    float centerSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.5f);
+    float rightSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.9f);
+
+    // Tower needs support from at least two points to remain stable
+    float support1 = std::min(leftSample, centerSample);
+    float support2 = std::min(centerSample, rightSample);
+    float support = std::max(support1, support2);
+
+    float bottom = object.rect.y + object.rect.h;
+    float gap = support - bottom;
+
+    // Check if tower should start falling due to lack of support
+    if (gap > SUPPORT_THRESHOLD && !object.falling) {
+        object.falling = true;
+        object.verticalVelocity = 0.0f;
+    }
+
+    // Apply physics if falling
+    if (object.falling) {
+        object.verticalVelocity += GRAVITY_ACC * dt;
+        object.rect.y += object.verticalVelocity * dt;
+
+        // Check for landing
+        if (gap <= 0.5f && object.verticalVelocity > 0.0f) {
+            object.rect.y = support - object.rect.h;
+            object.verticalVelocity = 0.0f;
+            object.falling = false;
+        }
+    } else if (gap > 0.5f) {
+        // Tower is not falling but terrain has eroded slightly - settle down
+        object.rect.y = support - object.rect.h;
+    }
+
+    // Destroy tower if it falls off the world
+    if (object.rect.y > LOGICAL_HEIGHT) {
+        object.alive = false;
+    }
+}
+
+void updateProjectiles(GameState& state, float dt) {
+    PROFILE_FUNCTION();
+    ProjectileStore& store = state.projectiles;
+    if (store.empty()) return;
+
+    const std::size_t span = store.span();
+    ProjectileIndexList& flagged = scratchIndices();
+    pendingShards().clear();
+    syncTankColliders(state);
+    ColliderList& nearby = nearbyColliders();
+
+    // Ages advance for the whole batch; only clusters due to split come back
+    advanceProjectileAges(store, dt, flagged);
+    for (std::uint32_t index : flagged) {
+        splitClusterProjectile(state, index);
+    }
+
+    integrateProjectiles(store, GRAVITY, dt);
+
+    // Only projectiles touching a screen edge take the scalar bounce path
+    findBoundaryContacts(store, static_cast<float>(LOGICAL_WIDTH), static_cast<float>(LOGICAL_HEIGHT), flagged);
+
+    std::size_t nextContact = 0;
+    for (std::size_t i = 0; i < span; ++i) {
+        const bool atEdge = nextContact < flagged.size() && flagged[nextContact] == i;
+        if (atEdge) ++nextContact;
+        if (!store.alive[i]) continue;
+
+        const ProjectileKind kind = store.kind[i];
+        const float radius = store.radius[i];
+        const Vec2 from{ store.prevX[i], store.prevY[i] };
+        const Vec2 to = store.position(i);
+        auto pointAt = [&](float t) { return Vec2{ lerp(from.x, to.x, t), lerp(from.y, to.y, t) }; };
+
+        // Sweep this step's segment against nearby towers and the heightfield
+        // so fast shots cannot tunnel through; the earliest contact wins
+        state.broadphase.query(std::min(from.x, to.x) - radius, std::max(from.x, to.x) + radius, nearby);
+        SceneryObject* struck = nullptr;
+        float sceneryTime = 2.0f;
+        for (ColliderRef ref : nearby) {
+            if (ref.kind != ColliderKind::Scenery) break;
+            SceneryObject& object = state.scenery[ref.index];
+            float t = 0.0f;
+            if (object.alive && sweepCircleRect(from, to, radius, object.rect, t) && t < sceneryTime) {
+                struck = &object;
+                sceneryTime = t;
+            }
+        }
+        // Steps entirely above the highest ground they span skip the column walk
+        const int firstColumn = static_cast<int>(std::floor(std::min(from.x, to.x)));
+        const int lastColumn = static_cast<int>(std::floor(std::max(from.x, to.x))) + 1;
+        const bool nearGround = std::max(from.y, to.y) + radius >= static_cast<float>(state.terrain.pyramid.minHeight(firstColumn, lastColumn));
+        float groundTime = 0.0f;
+        const bool grounded = nearGround && sweepTerrainContact(state.terrain.heights, from, to, radius, groundTime) && groundTime < sceneryTime;
+
+        if (struck && !grounded) {
+            const Vec2 position = pointAt(sceneryTime);
+            store.posX[i] = position.x;
+            store.posY[i] = position.y;
+            float dmg = static_cast<float>(store.damage[i]);
+            if (kind == ProjectileKind::Napalm) {
+                dmg *= 0.7f;
+            }
+            damageSceneryObject(state, *struck, dmg, position);
+            state.explosions.push_back({position, EXPLOSION_DURATION * 0.8f, EXPLOSION_DURATION * 0.8f, 20.0f, false});
+            if (kind == ProjectileKind::Napalm) {
+                float napalmRadius = 32.0f;
+                float napalmDepth = 11.0f;
+                carveCircularCrater(state, position.x, napalmRadius, napalmDepth);
+                NapalmPatch patch;
+                patch.position = position;
+                patch.radius = napalmRadius;
+                patch.currentRadius = 0.0f;
+                patch.timer = NAPALM_BURN_DURATION;
+                state.napalmPatches.push_back(patch);
+            }
+            store.release(i);
+            continue;
+        }
+
+        if (grounded) {
+            const Vec2 position = pointAt(groundTime);
+            store.posX[i] = position.x;
+            store.posY[i] = position.y;
+            float terrainY = terrainHeightAt(state.terrain.heights, position.x);
+            switch (kind) {
+                case ProjectileKind::Mortar:
+                    carveCircularCrater(state, position.x, 24.0f, 14.0f);
+                    break;
+                case ProjectileKind::Cluster:
+                    erodeTerrainLayers(state, position.x, 18.0f, 8.0f);
+                    break;
+                case ProjectileKind::ClusterShard:
+                    erodeTerrainLayers(state, position.x, 12.0f, 6.0f);
+                    break;
+                case ProjectileKind::Napalm: {
+                    float napalmRadius = 34.0f;
+                    float napalmDepth = 12.0f;
+                    carveCircularCrater(state, position.x, napalmRadius, napalmDepth);
+                    NapalmPatch patch;
+                    patch.position = position;
+                    patch.radius = napalmRadius;
+                    patch.currentRadius = 0.0f;
+                    patch.timer = NAPALM_BURN_DURATION;
+                    state.napalmPatches.push_back(patch);
+                    break;
+                }
+                case ProjectileKind::Grenade:
+                    if (store.bouncesRemaining[i] > 0) {
+                        // Bounce off terrain
+                        store.bouncesRemaining[i]--;
+                        store.posY[i] = terrainY - radius - 1.0f; // Move above ground
+                        store.velY[i] = -store.velY[i] * 0.6f; // Bounce with energy loss
+                        store.velX[i] *= 0.8f; // Reduce horizontal velocity
+                        continue; // Don't explode, keep bouncing
+                    } else {
+                        // No bounces left, explode
+                        erodeTerrainLayers(state, position.x, 16.0f, 8.0f);
+                    }
+                    break;
+                case ProjectileKind::Dirtgun:
+                    addTerrainMound(state, position.x, 50.0f, 20.0f);
+                    break;
+            }
+            state.explosions.push_back({position, EXPLOSION_DURATION, EXPLOSION_DURATION, 24.0f, kind == ProjectileKind::Napalm});
+            store.release(i);
+            continue;
+        }
+
+        // An edge either bounces a grenade, which then skips the tank checks
+        // this frame, or removes the projectile
+        if (atEdge) {
+            resolveScreenEdges(store, i);
+            continue;
+        }
+
+        if (!state.matchOver) {
+            // Only tanks whose hitbox or force field columns overlap the step
+            bool nearTarget[2] = { false, false };
+            for (ColliderRef ref : nearby) {
+                if (ref.kind != ColliderKind::Scenery) nearTarget[ref.index] = true;
+            }
+
+            Tank* targets[2] = { &state.player1, &state.player2 };
+            for (int t = 0; t < 2; ++t) {
+                Tank* target = targets[t];
+                if (!nearTarget[t] || store.owner[i] == target->id) continue;
+
+                // Check for force field collision first
+                if (target->forceFieldActive) {
+                    float tankCenterX = target->rect.x + target->rect.w * 0.5f;
+                    float tankCenterY = target->rect.y + target->rect.h * 0.5f;
+                    float dx = store.posX[i] - tankCenterX;
+                    float dy = store.posY[i] - tankCenterY;
+                    float distanceSquared = dx * dx + dy * dy;
+                    float forceFieldRadiusSquared = target->forceFieldRadius * target->forceFieldRadius;
+
+                    if (distanceSquared <= forceFieldRadiusSquared) {
+                        // Calculate bounce direction - reflect velocity away from tank center
+                        float distance = std::sqrt(distanceSquared);
+                        if (distance > 0.1f) {
+                            float normalX = dx / distance;
+                            float normalY = dy / distance;
+
+                            // Reflect velocity vector
+                            float dotProduct = store.velX[i] * normalX + store.velY[i] * normalY;
+                            store.velX[i] -= 2.0f * dotProduct * normalX;
+                            store.velY[i] -= 2.0f * dotProduct * normalY;
+
+                            // Add some bounce energy
+                            store.velX[i] *= 1.1f;
+                            store.velY[i] *= 1.1f;
+
+                            // Deactivate force field after use
+                            target->forceFieldActive = false;
+
+                            // Move projectile outside force field to prevent multiple bounces
+                            store.posX[i] = tankCenterX + normalX * (target->forceFieldRadius + store.radius[i] + 2.0f);
+                            store.posY[i] = tankCenterY + normalY * (target->forceFieldRadius + store.radius[i] + 2.0f);
+                        }
+                        continue; // Skip normal collision check
+                    }
+                }
+
+                Rect hitbox = tankHitbox(*target);
+                const Vec2 impact = store.position(i);
+                if (circleIntersectsRect(impact, store.radius[i], hitbox)) {
+                    target->hp -= store.damage[i];
+                    state.explosions.push_back({impact, EXPLOSION_DURATION, EXPLOSION_DURATION, 26.0f, false});
+                    switch (kind) {
+                        case ProjectileKind::Mortar:
+                            carveCircularCrater(state, impact.x, 22.0f, 12.0f);
+                            break;
+                        case ProjectileKind::Cluster:
+                        case ProjectileKind::ClusterShard:
+                            erodeTerrainLayers(state, impact.x, 16.0f, 8.0f);
+                            break;
+                        case ProjectileKind::Napalm: {
+                            float napalmRadius = 32.0f;
+                            float napalmDepth = 11.0f;
+                            carveCircularCrater(state, impact.x, napalmRadius, napalmDepth);
+                            NapalmPatch patch;
+                            patch.position = impact;
+                            patch.radius = napalmRadius;
+                            patch.currentRadius = 0.0f;
+                            patch.timer = NAPALM_BURN_DURATION;
+                            state.napalmPatches.push_back(patch);
+                            break;
+                        }
+                        case ProjectileKind::Grenade:
+                            erodeTerrainLayers(state, impact.x, 18.0f, 9.0f);
+                            break;
+                        case ProjectileKind::Dirtgun:
+                            addTerrainMound(state, impact.x, 50.0f, 20.0f);
+                            break;
+                    }
+                    store.release(i);
+                    if (target->hp <= 0) {
+                        target->exploding = true;
+                        target->explosionTimer = TANK_EXPLOSION_DURATION;
+                        state.explosions.push_back({
+                            Vec2{ target->rect.x + target->rect.w * 0.5f, target->rect.y + target->rect.h * 0.5f },
+                            TANK_EXPLOSION_DURATION,
+                            TANK_EXPLOSION_DURATION,
+                            48.0f,
+                            true
+                        });
+                        erodeTerrainLayers(state, target->rect.x + target->rect.w * 0.5f, 36.0f, 18.0f);
+                        state.matchOver = true;
+                        state.winner = (target->id == 1) ? 2 : 1;
+                        state.resetTimer = 3.0f;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    // Shards from this tick's splits first move on the next tick
+    for (const Projectile& shard : pendingShards()) {
+        store.spawn(shard);
+    }
+}
+
+void updateExplosions(ExplosionList& explosions, float dt) {
+    PROFILE_FUNCTION();
+    for (auto& explosion : explosions) {
+        explosion.timer -= dt;
+    }
+    explosions.erase(
+        std::remove_if(explosions.begin(), explosions.end(),
+                       [](const Explosion& e) { return e.timer <= 0.0f; }),
+        explosions.end());
+}
+
+void updateNapalmPatches(GameState& state, float dt) {
+    PROFILE_FUNCTION();
+    for (auto& patch : state.napalmPatches) {
+        if (patch.timer <= 0.0f) continue;
+        float growth = (patch.radius / std::max(0.2f, NAPALM_BURN_DURATION)) * dt * 1.4f;
+        patch.currentRadius = std::min(patch.radius, patch.currentRadius + growth);
+        patch.timer -= dt;
+    }
+
+    state.napalmPatches.erase(
+        std::remove_if(state.napalmPatches.begin(), state.napalmPatches.end(),
+                       [](const NapalmPatch& p) { return p.timer <= 0.0f; }),
+        state.napalmPatches.end());
+}
+
+void positionTankOnTerrain(Tank& tank, const std::vector<int>& terrain) {
+    float centerX = tank.rect.x + tank.rect.w * 0.5f;
+    float surfaceY = terrainHeightAt(terrain, centerX);
+    tank.rect.y = surfaceY - tank.rect.h;
+    tank.verticalVelocity = 0.0f;
+}
+
+void resetBotBrain(BotBrain& brain) {
+    brain.phase = BotPhase::Idle;
+    brain.thinkTimer = 0.0f;
+    brain.thinkDuration = 0.0f;
+    brain.angleError = 0.0f;
+    brain.powerError = 0.0f;
+    brain.planStale = true;
+    brain.planReady = false;
+    brain.planRevision = 0;
+    brain.rolloutSeed = 0;
+    brain.shieldThreat = ProjectileHandle{};
+    brain.shieldAnswer = false;
+    brain.targetAngle = 45.0f;
+    brain.targetPower = DEFAULT_LAUNCH_SPEED;
+    brain.targetAmmo = ProjectileKind::Mortar;
+    brain.firingTable.clear();
+}
+
+void resetMatch(GameState& state) {
+    PROFILE_FUNCTION();
+    generateTerrain(state.terrain.heights, state.terrain.substrate);
+    state.terrain.markDirty(ColumnRange{ 0, LOGICAL_WIDTH - 1 });
+    generateSceneryObjects(state);
+    state.projectiles.clear();
+    state.explosions.clear();
+    state.napalmPatches.clear();
+    state.matchOver = false;
+    state.winner = 0;
+    state.resetTimer = 2.0f;
+
+    state.player1.rect = makeTankRect(56.0f, 0.0f);
+    state.player2.rect = makeTankRect(LOGICAL_WIDTH - 72.0f, 0.0f);
+
+    positionTankOnTerrain(state.player1, state.terrain.heights);
+    positionTankOnTerrain(state.player2, state.terrain.heights);
+    state.player1.verticalVelocity = 0.0f;
+    state.player2.verticalVelocity = 0.0f;
+
+    state.player1.turretAngleDeg = 45.0f;
+    state.player2.turretAngleDeg = 45.0f;
+
+    state.player1.reloadTimer = 0.0f;
+    state.player2.reloadTimer = 0.0f;
+
+    state.player1.launchSpeed = DEFAULT_LAUNCH_SPEED;
+    state.player2.launchSpeed = DEFAULT_LAUNCH_SPEED;
+
+    state.player1.selected = ProjectileKind::Mortar;
+    state.player2.selected = ProjectileKind::Mortar;
+    state.player1.ammoSwitchHeld = false;
+    state.player2.ammoSwitchHeld = false;
+
+    state.player1.hp = TANK_HP;
+    state.player2.hp = TANK_HP;
+
+    state.player1.exploding = false;
+    state.player2.exploding = false;
+
+    // Reset force field states
+    state.player1.forceFieldActive = false;
+    state.player1.forceFieldAvailable = true;
+    state.player1.forceFieldKeyHeld = false;
+    state.player1.shotsFired = 0;
+    state.player2.forceFieldActive = false;
+    state.player2.forceFieldAvailable = true;
+    state.player2.forceFieldKeyHeld = false;
+    state.player2.shotsFired = 0;
+
+    // Initialize turn-based system
+    state.currentPlayer = 1;  // Player 1 starts
+    state.waitingForTurnEnd = false;
+    state.turnEndTimer = 0.0f;
+    state.shotFired = false;
+
+    // Initialize bot AI if in 1-player mode
+    if (state.gameMode == GameMode::OnePlayer) {
+        state.player2Bot.enabled = true;
+        state.player2Bot.difficulty = state.difficulty;
+    } else {
+        state.player2Bot.enabled = false;
+    }
+    resetBotBrain(state.player1Bot);
+    resetBotBrain(state.player2Bot);
+    state.player1.explosionTimer = 0.0f;
+    state.player2.explosionTimer = 0.0f;
+}
+
+void stepSimulation(GameState& state, const InputState& input, float dt) {
+    PROFILE_FUNCTION();
+    if (state.currentScreen == GameScreen::Playing) {
+        if (!state.matchOver) {
+            // Update tanks based on play mode
+            bool player1CanControl, player2CanControl;
+            if (state.playMode == PlayMode::FreeForAll) {
+                // In free-for-all, both players can control their tanks
+                player1CanControl = !state.player1Bot.enabled;
+                player2CanControl = !state.player2Bot.enabled; // Bot still controlled by AI
+            } else {
+                // Turn-based logic
+                player1CanControl = state.currentPlayer == 1 && !state.player1Bot.enabled;
+                player2CanControl = state.currentPlayer == 2 && !state.player2Bot.enabled;
+            }
+
+            updateTank(state.player1, input, dt, player1CanControl, state);
+            updateTank(state.player2, input, dt, player2CanControl, state);
+            updateProjectiles(state, dt);
+
+            // Update bot AI if it's bot's turn
+            updateBotAI(state, state.player1, state.player2, state.player1Bot, dt);
+            updateBotAI(state, state.player2, state.player1, state.player2Bot, dt);
+
+            // Handle turn switching (only in turn-based mode)
+            if (state.playMode == PlayMode::TurnBased && state.waitingForTurnEnd) {
+                state.turnEndTimer -= dt;
+                // Check if all projectiles have finished (no active projectiles or napalm)
+                bool allProjectilesFinished = state.projectiles.empty();
+                bool allExplosionsFinished = state.explosions.empty() ||
+                    std::all_of(state.explosions.begin(), state.explosions.end(),
+                        [](const Explosion& e) { return e.timer <= 0.0f; });
+
+                // Switch turns when timer expires OR all effects are finished
+                if (state.turnEndTimer <= 0.0f || (allProjectilesFinished && allExplosionsFinished)) {
+                    state.currentPlayer = (state.currentPlayer == 1) ? 2 : 1;
+                    state.waitingForTurnEnd = false;
+                    state.shotFired = false;
+                    state.turnEndTimer = 0.0f;
+                }
+            }
+        } else {
+            state.resetTimer -= dt;
+            if (state.resetTimer <= 0.0f) {
+                state.currentScreen = GameScreen::Menu; // Return to menu after match
+            }
+        }
+    }
+
+    updateExplosions(state.explosions, dt);
+    updateNapalmPatches(state, dt);
+    applyGravityToTank(state.player1, state.terrain.heights, dt);
+    applyGravityToTank(state.player2, state.terrain.heights, dt);
+
+    // Apply gravity to towers; a resting tower only needs rechecking when the
+    // ground under it was edited since the last support pass
+    const ColumnRange dirty = state.terrain.pendingDirty();
+    for (auto& scenery : state.scenery) {
+        const int footLeft = static_cast<int>(std::floor(scenery.rect.x));
+        const int footRight = static_cast<int>(std::floor(scenery.rect.x + scenery.rect.w)) + 1;
+        if (!scenery.falling && !dirty.overlaps(footLeft, footRight)) continue;
+        applyGravityToScenery(scenery, state.terrain.heights, dt);
+        if (!scenery.alive) {
+            state.broadphase.remove(sceneryCollider(state, scenery));
+        }
+    }
+    if (state.player1.exploding) {
+        state.player1.explosionTimer -= dt;
+        if (state.player1.explosionTimer <= 0.0f) {
+            state.player1.exploding = false;
+        }
+    }
+    if (state.player2.exploding) {
+        state.player2.explosionTimer -= dt;
+        if (state.player2.explosionTimer <= 0.0f) {
+            state.player2.exploding = false;
+        }
+    }
+    state.terrain.endTick();
+}
+
+} // namespace tankduel
@@ -0,0 +1,38 @@
+// src/core/simulation.h
+#pragma once
+#include <vector>
+
+#include "game_state.h"
+#include "input.h"
+
+namespace tankduel {
+
+Rect makeTankRect(float x, float y);
+float turretWorldAngleDeg(const Tank& tank);
+Rect tankHitbox(const Tank& tank);
+bool circleIntersectsRect(const Vec2& center, float radius, const Rect& rect);
+// First fraction of the segment from -> to at which the moving circle touches
+// rect; false if it stays clear for the whole segment.
+bool sweepCircleRect(const Vec2& from, const Vec2& to, float radius, const Rect& rect, float& toi);
+
+Projectile spawnProjectile(const Tank& tank);
+ProjectileHandle launchProjectile(GameState& state, const Projectile& proj);
+
+void damageSceneryObject(GameState& state, SceneryObject& object, float amount, const Vec2& impact);
+void generateSceneryObjects(GameState& state);
+
+void updateTank(Tank& tank, const InputState& input, float dt, bool isCurrentPlayer, GameState& state);
+void applyGravityToTank(Tank& tank, const std::vector<int>& terrain, float dt);
+void applyGravityToScenery(SceneryObject& object, const std::vector<int>& terrain, float dt);
+void updateProjectiles(GameState& state, float dt);
+void updateExplosions(ExplosionList& explosions, float dt);
+void updateNapalmPatches(GameState& state, float dt);
+
+void positionTankOnTerrain(Tank& tank, const std::vector<int>& terrain);
+void resetBotBrain(BotBrain& brain);
+void resetMatch(GameState& state);
+
+// Advances the whole game by exactly one fixed tick. Needs no window or renderer.
+void stepSimulation(GameState& state, const InputState& input, float dt);
+
+} // namespace tankduel
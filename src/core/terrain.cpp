@@ -0,0 +1,214 @@
+// src/core/terrain.cpp
+#include "terrain.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "profiler.h"
+#include "random.h"
+
+namespace tankduel {
+
+float terrainHeightAt(const std::vector<int>& heights, float x) {
+    if (heights.empty()) return static_cast<float>(LOGICAL_HEIGHT - 1);
+    float clamped = std::clamp(x, 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
+    int x0 = static_cast<int>(std::floor(clamped));
+    int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
+    float t = clamped - static_cast<float>(x0);
+    return static_cast<float>(heights[x0]) + (static_cast<float>(heights[x1]) - static_cast<float>(heights[x0])) * t;
+}
+
+float substrateHeightAt(const std::vector<int>& substrate, float x) {
+    if (substrate.empty()) return static_cast<float>(LOGICAL_HEIGHT - 1);
+    float clamped = std::clamp(x, 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
+    int x0 = static_cast<int>(std::floor(clamped));
+    int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
+    float t = clamped - static_cast<float>(x0);
+    return static_cast<float>(substrate[x0]) + (static_cast<float>(substrate[x1]) - static_cast<float>(substrate[x0])) * t;
+}
+
+bool sweepTerrainContact(const std::vector<int>& heights, const Vec2& from, const Vec2& to, float radius, float& toi) {
+    const float dx = to.x - from.x;
+    const float dy = to.y - from.y;
+    // Signed clearance; the surface is linear between integer columns, so is
+    // this between consecutive column crossings and each root is exact
+    auto penetration = [&](float t) {
+        return from.y + dy * t + radius - terrainHeightAt(heights, from.x + dx * t);
+    };
+
+    float tA = 0.0f;
+    float fA = penetration(0.0f);
+    if (fA >= 0.0f) {
+        toi = 0.0f;
+        return true;
+    }
+
+    const float lastColumn = static_cast<float>(LOGICAL_WIDTH - 1);
+    float column = dx > 0.0f ? std::floor(from.x) + 1.0f : std::ceil(from.x) - 1.0f;
+    while (tA < 1.0f) {
+        float tB = 1.0f;
+        if (dx != 0.0f && column >= 0.0f && column <= lastColumn) {
+            tB = std::min(1.0f, (column - from.x) / dx);
+            column += dx > 0.0f ? 1.0f : -1.0f;
+        } else if (dx > 0.0f && column < 0.0f) {
+            // Left of the world the surface is flat until column 0
+            column = 0.0f;
+            tB = std::min(1.0f, (column - from.x) / dx);
+            column += 1.0f;
+        } else if (dx < 0.0f && column > lastColumn) {
+            column = lastColumn;
+            tB = std::min(1.0f, (column - from.x) / dx);
+            column -= 1.0f;
+        }
+        tB = std::max(tB, tA);
+
+        const float fB = penetration(tB);
+        if (fB >= 0.0f) {
+            toi = tA + (tB - tA) * (-fA / (fB - fA));
+            return true;
+        }
+        tA = tB;
+        fA = fB;
+    }
+    return false;
+}
+
+void generateTerrain(std::vector<int>& surface, std::vector<int>& substrate) {
+    PROFILE_FUNCTION();
+    surface.resize(LOGICAL_WIDTH);
+    substrate.resize(LOGICAL_WIDTH);
+
+    const int segments = 10;
+    std::array<float, segments + 1> controls{};
+    const float baseLine = TERRAIN_BASELINE - randomFloat(4.0f, 10.0f);
+    for (int i = 0; i <= segments; ++i) {
+        controls[i] = baseLine + randomFloat(-8.0f, 8.0f);
+    }
+
+    for (int v = 0; v < 2; ++v) {
+        int idx = std::clamp(static_cast<int>(randomFloat(1.0f, static_cast<float>(segments - 1))), 1, segments - 1);
+        controls[idx] += randomFloat(28.0f, 40.0f);
+    }
+    for (int c = 0; c < 2; ++c) {
+        int idx = std::clamp(static_cast<int>(randomFloat(1.0f, static_cast<float>(segments - 1))), 1, segments - 1);
+        controls[idx] -= randomFloat(18.0f, 30.0f);
+    }
+
+    float segmentWidth = static_cast<float>(LOGICAL_WIDTH) / segments;
+    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
+        float fx = static_cast<float>(x);
+        int seg = std::min(static_cast<int>(fx / segmentWidth), segments - 1);
+        float t = (fx - seg * segmentWidth) / segmentWidth;
+        float start = controls[seg];
+        float end = controls[seg + 1];
+        float base = start + (end - start) * t;
+        base += std::sin(fx * 0.07f + controls[seg] * 0.02f) * 3.0f;
+        base += std::sin(fx * 0.18f + controls[seg + 1] * 0.015f) * 2.0f;
+        surface[x] = static_cast<int>(std::round(base));
+    }
+
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<int> temp = surface;
+        for (int x = 1; x < LOGICAL_WIDTH - 1; ++x) {
+            temp[x] = static_cast<int>(std::round(surface[x] * 0.6f + surface[x - 1] * 0.2f + surface[x + 1] * 0.2f));
+        }
+        surface.swap(temp);
+    }
+
+    for (int& h : surface) {
+        h = std::clamp(h, LOGICAL_HEIGHT - 118, LOGICAL_HEIGHT - 32);
+    }
+
+    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
+        float substrateBase = static_cast<float>(surface[x]) + randomFloat(14.0f, 22.0f);
+        substrate[x] = static_cast<int>(std::round(std::min(substrateBase, static_cast<float>(LOGICAL_HEIGHT - 14))));
+        substrate[x] = std::max(substrate[x], surface[x] + 10);
+    }
+}
+
+void erodeTerrainLayers(GameState& state, float centerX, float radius, float depth) {
+    PROFILE_FUNCTION();
+    ColumnRange changed = deformTerrain(state.terrain.heights, centerX, radius, depth);
+    changed.include(deformTerrain(state.terrain.substrate, centerX, radius * 0.7f, depth * 0.35f));
+    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
+    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
+    for (int x = start; x <= end; ++x) {
+        if (x >= 0 && x < static_cast<int>(state.terrain.heights.size()) && x < static_cast<int>(state.terrain.substrate.size())) {
+            state.terrain.heights[x] = std::min(state.terrain.heights[x], state.terrain.substrate[x] - 2);
+        }
+    }
+    changed.include(ColumnRange{ start, end });
+    state.terrain.markDirty(changed);
+}
+
+void carveCircularCrater(GameState& state, float centerX, float radius, float depth) {
+    PROFILE_FUNCTION();
+    if (radius <= 0.0f || depth <= 0.0f) return;
+    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
+    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
+    float radiusSq = radius * radius;
+    for (int x = start; x <= end; ++x) {
+        float dx = static_cast<float>(x) - centerX;
+        float distSq = dx * dx;
+        if (distSq > radiusSq) continue;
+        float normalized = distSq / radiusSq;
+        float drop = depth * std::sqrt(std::max(0.0f, 1.0f - normalized));
+        if (x < static_cast<int>(state.terrain.heights.size())) {
+            state.terrain.heights[x] = std::min(LOGICAL_HEIGHT - 8, state.terrain.heights[x] + static_cast<int>(std::round(drop)));
+        }
+        if (x < static_cast<int>(state.terrain.substrate.size())) {
+            state.terrain.substrate[x] = std::min(LOGICAL_HEIGHT - 6, state.terrain.substrate[x] + static_cast<int>(std::round(drop * 0.35f)));
+            state.terrain.substrate[x] = std::max(state.terrain.substrate[x], state.terrain.heights[x] + 8);
+        }
+    }
+    state.terrain.markDirty(ColumnRange{ start, end });
+}
+
+void addTerrainMound(GameState& state, float centerX, float radius, float height) {
+    PROFILE_FUNCTION();
+    if (radius <= 0.0f || height <= 0.0f) return;
+    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
+    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
+    float radiusSq = radius * radius;
+
+    for (int x = start; x <= end; ++x) {
+        float dx = static_cast<float>(x) - centerX;
+        float distSq = dx * dx;
+        if (distSq > radiusSq) continue;
+        float normalized = distSq / radiusSq;
+        float addition = height * std::sqrt(std::max(0.0f, 1.0f - normalized));
+
+        if (x >= 0 && x < static_cast<int>(state.terrain.heights.size())) {
+            state.terrain.heights[x] = std::max(LOGICAL_HEIGHT - 140, static_cast<int>(state.terrain.heights[x] - addition));
+            state.terrain.heights[x] = std::min(LOGICAL_HEIGHT - 20, state.terrain.heights[x]);
+        }
+        if (x >= 0 && x < static_cast<int>(state.terrain.substrate.size())) {
+            state.terrain.substrate[x] = std::max(LOGICAL_HEIGHT - 140, static_cast<int>(state.terrain.substrate[x] - addition * 0.7f));
+            state.terrain.substrate[x] = std::min(LOGICAL_HEIGHT - 20, state.terrain.substrate[x]);
+        }
+    }
+    state.terrain.markDirty(ColumnRange{ start, end });
+}
+
+ColumnRange deformTerrain(std::vector<int>& terrain, float centerX, float radius, float depth) {
+    if (terrain.empty()) return {};
+    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
+    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
+    for (int x = start; x <= end; ++x) {
+        float dx = static_cast<float>(x) - centerX;
+        float dist = std::abs(dx);
+        if (dist > radius) continue;
+        float t = dist / radius;
+        float falloff = (1.0f - t * t);
+        float delta = depth * falloff;
+        terrain[x] = std::min(LOGICAL_HEIGHT - 8, terrain[x] + static_cast<int>(std::round(delta)));
+    }
+    // Only the edited span can have left the playable band
+    for (int x = start; x <= end; ++x) {
+        terrain[x] = std::clamp(terrain[x], LOGICAL_HEIGHT - 140, LOGICAL_HEIGHT - 20);
+    }
+    return ColumnRange{ start, end };
+}
+
+} // namespace tankduel
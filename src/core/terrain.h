@@ -0,0 +1,23 @@
+// src/core/terrain.h
+#pragma once
+#include <vector>
+
+#include "game_state.h"
+
+namespace tankduel {
+
+float terrainHeightAt(const std::vector<int>& heights, float x);
+float substrateHeightAt(const std::vector<int>& substrate, float x);
+// First fraction of the segment from -> to at which a circle of `radius`
+// touches the interpolated surface (bottom + radius >= ground). False if it
+// stays clear for the whole segment.
+bool sweepTerrainContact(const std::vector<int>& heights, const Vec2& from, const Vec2& to, float radius, float& toi);
+void generateTerrain(std::vector<int>& surface, std::vector<int>& substrate);
+
+// Deforms and clamps one layer; returns the columns it touched
+ColumnRange deformTerrain(std::vector<int>& terrain, float centerX, float radius, float depth);
+void erodeTerrainLayers(GameState& state, float centerX, float radius, float depth);
+void carveCircularCrater(GameState& state, float centerX, float radius, float depth);
+void addTerrainMound(GameState& state, float centerX, float radius, float height);
+
+} // namespace tankduel
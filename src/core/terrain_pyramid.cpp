@@ -0,0 +1,72 @@
+// src/core/terrain_pyramid.cpp
+#include "terrain_pyramid.h"
+
+#include <algorithm>
+
+namespace tankduel {
+
+void TerrainPyramid::update(const std::vector<int>& heights, ColumnRange columns) {
+    if (heights.size() < static_cast<size_t>(LOGICAL_WIDTH)) return;
+    int first = std::max(0, columns.first);
+    int last = std::min(LOGICAL_WIDTH - 1, columns.last);
+    if (first > last) return;
+
+    for (int x = first; x <= last; ++x) {
+        nodes_[x] = heights[x];
+    }
+    for (int level = 1; level < TERRAIN_PYRAMID_LEVELS; ++level) {
+        first >>= 1;
+        last >>= 1;
+        const int below = terrainPyramidOffset(level - 1);
+        const int belowSize = terrainPyramidSize(level - 1);
+        for (int j = first; j <= last; ++j) {
+            int value = nodes_[below + 2 * j];
+            if (2 * j + 1 < belowSize) {
+                value = std::min(value, nodes_[below + 2 * j + 1]);
+            }
+            nodes_[terrainPyramidOffset(level) + j] = value;
+        }
+    }
+}
+
+int TerrainPyramid::minHeight(int first, int last) const {
+    // Out-of-world columns read the edge column, as terrainHeightAt does
+    first = std::clamp(first, 0, LOGICAL_WIDTH - 1);
+    last = std::clamp(last, 0, LOGICAL_WIDTH - 1);
+    int result = LOGICAL_HEIGHT;
+    // Standard bottom-up range decomposition: peel unaligned ends per level
+    for (int level = 0; first <= last; ++level) {
+        if (first & 1) result = std::min(result, node(level, first++));
+        if (!(last & 1)) result = std::min(result, node(level, last--));
+        first >>= 1;
+        last >>= 1;
+        if (level + 1 == TERRAIN_PYRAMID_LEVELS) break;
+    }
+    return result;
+}
+
+bool TerrainPyramid::findSkySpan(float x, float bottomY, float& spanStart, float& spanEnd, float& spanGround) const {
+    if (x < 0.0f || x >= static_cast<float>(LOGICAL_WIDTH - 1)) return false;
+    const int column = static_cast<int>(x);
+
+    bool found = false;
+    for (int level = 1; level < TERRAIN_PYRAMID_LEVELS; ++level) {
+        const int index = column >> level;
+        const int ground = node(level, index);
+        if (static_cast<float>(ground) <= bottomY) break;
+
+        // Interpolation reads the next column too, so the span ends one
+        // column before the block does
+        const int blockStart = index << level;
+        const int blockEnd = std::min(LOGICAL_WIDTH - 1, ((index + 1) << level) - 1);
+        if (column < blockEnd) {
+            spanStart = static_cast<float>(blockStart);
+            spanEnd = static_cast<float>(blockEnd);
+            spanGround = static_cast<float>(ground);
+            found = true;
+        }
+    }
+    return found;
+}
+
+} // namespace tankduel
@@ -0,0 +1,63 @@
+// src/core/terrain_pyramid.h
+#pragma once
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "constants.h"
+
+namespace tankduel {
+
+// Inclusive range of terrain columns; empty when first > last.
+struct ColumnRange {
+    int first{0};
+    int last{-1};
+
+    bool empty() const { return first > last; }
+    bool overlaps(int otherFirst, int otherLast) const { return first <= otherLast && otherFirst <= last; }
+    void include(ColumnRange other) {
+        if (other.empty()) return;
+        if (empty()) {
+            *this = other;
+            return;
+        }
+        first = std::min(first, other.first);
+        last = std::max(last, other.last);
+    }
+};
+
+constexpr int TERRAIN_PYRAMID_LEVELS = 11;
+static_assert((1 << (TERRAIN_PYRAMID_LEVELS - 1)) >= LOGICAL_WIDTH, "top level must cover the world");
+
+constexpr int terrainPyramidSize(int level) {
+    return (LOGICAL_WIDTH + (1 << level) - 1) >> level;
+}
+
+constexpr int terrainPyramidOffset(int level) {
+    int offset = 0;
+    for (int k = 0; k < level; ++k) offset += terrainPyramidSize(k);
+    return offset;
+}
+
+// Min-Y (highest ground) mip pyramid over the terrain columns. Level k node j
+// covers columns [j << k, ((j + 1) << k) - 1]. Kept in sync with the height
+// array through Terrain::markDirty.
+class TerrainPyramid {
+public:
+    void update(const std::vector<int>& heights, ColumnRange columns);
+
+    // Highest ground (smallest y) over columns [first, last], clamped to the world
+    int minHeight(int first, int last) const;
+
+    // Finds the widest aligned block around x whose ground lies entirely below
+    // bottomY. While x stays in [spanStart, spanEnd) and the projectile bottom
+    // stays above spanGround, interpolated terrain cannot be reached.
+    bool findSkySpan(float x, float bottomY, float& spanStart, float& spanEnd, float& spanGround) const;
+
+private:
+    int node(int level, int index) const { return nodes_[terrainPyramidOffset(level) + index]; }
+
+    std::array<int, terrainPyramidOffset(TERRAIN_PYRAMID_LEVELS)> nodes_{};
+};
+
+} // namespace tankduel
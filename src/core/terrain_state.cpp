@@ -0,0 +1,28 @@
+// src/core/terrain_state.cpp
+#include "terrain_state.h"
+
+namespace tankduel {
+
+void Terrain::markDirty(ColumnRange columns) {
+    if (columns.empty()) return;
+    pyramid.update(heights, columns);
+    pending_.include(columns);
+    history_[revision_ % TERRAIN_EDIT_HISTORY] = columns;
+    ++revision_;
+}
+
+ColumnRange Terrain::dirtySince(std::uint32_t revision) const {
+    if (revision_ - revision > TERRAIN_EDIT_HISTORY) return ColumnRange{ 0, LOGICAL_WIDTH - 1 };
+    ColumnRange dirty;
+    for (std::uint32_t edit = revision; edit != revision_; ++edit) {
+        dirty.include(history_[edit % TERRAIN_EDIT_HISTORY]);
+    }
+    return dirty;
+}
+
+void Terrain::endTick() {
+    lastTick_ = pending_;
+    pending_ = ColumnRange{};
+}
+
+} // namespace tankduel
@@ -0,0 +1,45 @@
+// src/core/terrain_state.h
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "terrain_pyramid.h"
+
+namespace tankduel {
+
+// Edits remembered for dirtySince; older queries see the whole world as dirty
+constexpr std::uint32_t TERRAIN_EDIT_HISTORY = 32;
+
+// Surface and substrate heightfields plus the data derived from them. Every
+// edit reports its columns through markDirty, so the pyramid and downstream
+// caches (renderer, AI, tower support) only revisit what changed.
+class Terrain {
+public:
+    std::vector<int> heights{};    // surface y per column
+    std::vector<int> substrate{};  // substrate y per column
+    TerrainPyramid pyramid{};
+
+    // Records an edit to either layer and refreshes the pyramid over it
+    void markDirty(ColumnRange columns);
+    // Closes a simulation tick: pending edits become the tick's dirty span
+    void endTick();
+
+    // Columns edited since the last endTick, including edits made between
+    // ticks such as a new match
+    ColumnRange pendingDirty() const { return pending_; }
+    // Columns edited during the last completed tick
+    ColumnRange tickDirty() const { return lastTick_; }
+    // Bumped on every edit; cheap cache key for derived data
+    std::uint32_t revision() const { return revision_; }
+    // Columns edited since `revision` was current
+    ColumnRange dirtySince(std::uint32_t revision) const;
+
+private:
+    std::array<ColumnRange, TERRAIN_EDIT_HISTORY> history_{};
+    ColumnRange pending_{};
+    ColumnRange lastTick_{};
+    std::uint32_t revision_{0};
+};
+
+} // namespace tankduel
@@ -0,0 +1,173 @@
+// src/core/threat.cpp
+#include "threat.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "game_state.h"
+#include "profiler.h"
+#include "simd.h"
+
+namespace tankduel {
+
+namespace {
+
+constexpr float THREAT_DT = 1.0f / static_cast<float>(DEFAULT_TICK_RATE);
+
+struct ThreatBox {
+    float left, top, right, bottom;
+};
+
+// What the lanes test against, gathered once per call
+struct ThreatScene {
+    const std::vector<int>* heights{nullptr};
+    float groundTop{0.0f};  // highest ground anywhere
+    float towerTop{0.0f};   // highest live tower top
+    FixedVector<ThreatBox, MAX_SCENERY_OBJECTS> towers{};
+    std::array<const Tank*, 2> tanks{};
+    std::array<float, 2> centerX{};
+    std::array<float, 2> centerY{};
+};
+
+simd::Mask touchesBox(simd::Float x, simd::Float y, simd::Float radius, const ThreatBox& box) {
+    return (x + radius >= simd::splat(box.left)) & (x - radius <= simd::splat(box.right)) &
+           (y + radius >= simd::splat(box.top)) & (y - radius <= simd::splat(box.bottom));
+}
+
+// Follows simd::WIDTH slots from `first` until each lane enters an enemy's
+// field radius or stops, keeping the earliest entry per tank
+void sweepLanes(const ProjectileStore& store, std::size_t first, int steps, const ThreatScene& scene,
+                ThreatReport& report) {
+    int active = 0;
+    std::array<int, 2> enemyOf{};
+    for (int lane = 0; lane < simd::WIDTH; ++lane) {
+        const std::size_t slot = first + static_cast<std::size_t>(lane);
+        if (slot >= store.span() || !store.alive[slot]) continue;
+        active |= 1 << lane;
+        for (int t = 0; t < 2; ++t) {
+            if (store.owner[slot] != scene.tanks[t]->id) enemyOf[t] |= 1 << lane;
+        }
+    }
+    if (!active) return;
+
+    simd::Float x = simd::load(&store.posX[first]);
+    simd::Float y = simd::load(&store.posY[first]);
+    const simd::Float vx = simd::load(&store.velX[first]);
+    simd::Float vy = simd::load(&store.velY[first]);
+    const simd::Float radius = simd::load(&store.radius[first]);
+    const simd::Float step = simd::splat(THREAT_DT);
+    const simd::Float fall = simd::splat(GRAVITY * THREAT_DT);
+    const simd::Float left = simd::splat(0.0f);
+    const simd::Float right = simd::splat(static_cast<float>(LOGICAL_WIDTH));
+    const simd::Float floor = simd::splat(static_cast<float>(LOGICAL_HEIGHT));
+    const simd::Float groundTop = simd::splat(scene.groundTop);
+    const simd::Float towerTop = simd::splat(scene.towerTop);
+    const std::vector<int>& heights = *scene.heights;
+
+    std::array<simd::Float, 2> fieldX{}, fieldY{}, fieldRadiusSq{};
+    for (int t = 0; t < 2; ++t) {
+        fieldX[t] = simd::splat(scene.centerX[t]);
+        fieldY[t] = simd::splat(scene.centerY[t]);
+        fieldRadiusSq[t] = simd::splat(scene.tanks[t]->forceFieldRadius * scene.tanks[t]->forceFieldRadius);
+    }
+
+    alignas(32) std::array<float, simd::WIDTH> laneX{};
+    alignas(32) std::array<float, simd::WIDTH> laneY{};
+    alignas(32) std::array<float, simd::WIDTH> ground{};
+
+    for (int n = 1; n <= steps && active; ++n) {
+        // Same semi-implicit step as integrateProjectiles
+        vy = vy + fall;
+        x = x + vx * step;
+        y = y + vy * step;
+
+        // Field first, as updateProjectiles tests it before the hitbox
+        int enteredBits = 0;
+        for (int t = 0; t < 2; ++t) {
+            const simd::Float dx = x - fieldX[t];
+            const simd::Float dy = y - fieldY[t];
+            const int inside = simd::bits(dx * dx + dy * dy <= fieldRadiusSq[t]) & active & enemyOf[t];
+            if (!inside) continue;
+            simd::store(laneX.data(), x);
+            simd::store(laneY.data(), y);
+            IncomingThreat& threat = report.tanks[t];
+            const float time = static_cast<float>(n) * THREAT_DT;
+            for (int lane = 0; lane < simd::WIDTH; ++lane) {
+                if (!(inside & (1 << lane)) || time >= threat.timeToImpact) continue;
+                threat.timeToImpact = time;
+                threat.projectile = store.handleAt(first + static_cast<std::size_t>(lane));
+                threat.entry = Vec2{ laneX[lane], laneY[lane] };
+            }
+            enteredBits |= inside;
+        }
+        active &= ~enteredBits;
+        if (!active) break;
+
+        // Heightfield gather only once a lane is low enough to reach the
+        // highest ground, interpolated like terrainHeightAt
+        int stoppedBits = 0;
+        if (simd::bits(y + radius >= groundTop) & active) {
+            simd::store(laneX.data(), x);
+            for (int lane = 0; lane < simd::WIDTH; ++lane) {
+                const float column = std::clamp(laneX[lane], 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
+                const int x0 = static_cast<int>(column);
+                const int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
+                const float h0 = static_cast<float>(heights[x0]);
+                ground[lane] = h0 + (static_cast<float>(heights[x1]) - h0) * (column - static_cast<float>(x0));
+            }
+            stoppedBits = simd::bits(y + radius >= simd::load(ground.data()));
+        }
+        if (!scene.towers.empty() && (simd::bits(y + radius >= towerTop) & active)) {
+            simd::Mask blocked = touchesBox(x, y, radius, scene.towers[0]);
+            for (std::size_t i = 1; i < scene.towers.size(); ++i) {
+                blocked = blocked | touchesBox(x, y, radius, scene.towers[i]);
+            }
+            stoppedBits |= simd::bits(blocked);
+        }
+        // Screen edges release the projectile (a grenade's bounce is
+        // predicted afresh once it has happened); above the top it falls back
+        const simd::Mask gone = (x - radius <= left) | (x + radius >= right) | (y - radius > floor);
+        stoppedBits |= simd::bits(gone);
+        active &= ~stoppedBits;
+    }
+}
+
+} // namespace
+
+const IncomingThreat& ThreatReport::against(const Tank& tank) const {
+    return tanks[tank.id == 1 ? 0 : 1];
+}
+
+ThreatReport predictThreats(const GameState& state, float horizon) {
+    PROFILE_FUNCTION();
+    ThreatReport report;
+    const ProjectileStore& store = state.projectiles;
+    if (store.empty() || state.terrain.heights.empty()) return report;
+
+    ThreatScene scene;
+    scene.heights = &state.terrain.heights;
+    scene.groundTop = static_cast<float>(*std::min_element(state.terrain.heights.begin(), state.terrain.heights.end()));
+    scene.towerTop = static_cast<float>(LOGICAL_HEIGHT);
+    for (const SceneryObject& object : state.scenery) {
+        if (!object.alive || scene.towers.full()) continue;
+        scene.towers.push_back(ThreatBox{ object.rect.x, object.rect.y, object.rect.x + object.rect.w,
+                                          object.rect.y + object.rect.h });
+        scene.towerTop = std::min(scene.towerTop, object.rect.y);
+    }
+    scene.tanks = { &state.player1, &state.player2 };
+    for (int t = 0; t < 2; ++t) {
+        scene.centerX[t] = scene.tanks[t]->rect.x + scene.tanks[t]->rect.w * 0.5f;
+        scene.centerY[t] = scene.tanks[t]->rect.y + scene.tanks[t]->rect.h * 0.5f;
+    }
+
+    const int steps = static_cast<int>(horizon / THREAT_DT);
+    for (std::size_t first = 0; first < store.span(); first += simd::WIDTH) {
+        sweepLanes(store, first, steps, scene, report);
+    }
+    return report;
+}
+
+} // namespace tankduel
@@ -0,0 +1,41 @@
+// src/core/threat.h
+#pragma once
+#include <array>
+#include <limits>
+
+#include "math.h"
+#include "projectile_store.h"
+
+namespace tankduel {
+
+struct GameState;
+struct Tank;
+
+// How far ahead predictThreats follows projectiles; a turn ends 3 s after
+// the shot at the latest
+constexpr float THREAT_HORIZON = 3.0f;
+constexpr float NO_THREAT = std::numeric_limits<float>::infinity();
+
+// The first enemy projectile predicted to cross a tank's force-field radius
+struct IncomingThreat {
+    float timeToImpact{NO_THREAT};  // seconds from now
+    ProjectileHandle projectile{};
+    Vec2 entry{};                   // where it crosses the radius
+
+    bool incoming() const { return projectile.valid(); }
+};
+
+// Threats against player1 and player2, in that order
+struct ThreatReport {
+    std::array<IncomingThreat, 2> tanks{};
+
+    const IncomingThreat& against(const Tank& tank) const;
+};
+
+// Follows every live projectile's arc in SIMD lanes, with the gravity step
+// updateProjectiles uses, until it crosses an enemy tank's force-field
+// radius, lands on the heightfield or a tower, or leaves the screen. Whether
+// the field is up does not matter: the answer is when it would be needed.
+ThreatReport predictThreats(const GameState& state, float horizon = THREAT_HORIZON);
+
+} // namespace tankduel
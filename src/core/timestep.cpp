@@ -0,0 +1,65 @@
+// src/core/timestep.cpp
+#include "timestep.h"
+
+#include <algorithm>
+
+namespace tankduel {
+
+namespace {
+
+void blendRect(Rect& out, const Rect& previous, float alpha) {
+    out.x = lerp(previous.x, out.x, alpha);
+    out.y = lerp(previous.y, out.y, alpha);
+}
+
+} // namespace
+
+// Feeds real frame time into the accumulator and returns how many ticks to run.
+// Once the catch-up cap is hit the remaining backlog is dropped so a long stall
+// slows the game down briefly instead of spiralling.
+int consumeFrameTime(FixedTimestep& timestep, double frameSeconds) {
+    timestep.accumulator += std::clamp(frameSeconds, 0.0, MAX_FRAME_TIME);
+    int ticks = static_cast<int>(timestep.accumulator / timestep.tickSeconds);
+    if (ticks > timestep.maxCatchUpTicks) {
+        ticks = timestep.maxCatchUpTicks;
+        timestep.accumulator = timestep.tickSeconds * ticks;
+    }
+    timestep.accumulator -= timestep.tickSeconds * ticks;
+    return ticks;
+}
+
+float interpolationAlpha(const FixedTimestep& timestep) {
+    return static_cast<float>(std::clamp(timestep.accumulator / timestep.tickSeconds, 0.0, 1.0));
+}
+
+// Builds the state to draw: the latest tick with moving bodies blended back
+// towards the previous tick. Projectiles are paired by id (both lists stay
+// sorted by id); ones spawned this tick are drawn at their current position.
+GameState interpolateForRender(const GameState& previous, const GameState& current, float alpha) {
+    GameState view = current;
+
+    blendRect(view.player1.rect, previous.player1.rect, alpha);
+    blendRect(view.player2.rect, previous.player2.rect, alpha);
+    view.player1.turretAngleDeg = lerp(previous.player1.turretAngleDeg, current.player1.turretAngleDeg, alpha);
+    view.player2.turretAngleDeg = lerp(previous.player2.turretAngleDeg, current.player2.turretAngleDeg, alpha);
+
+    if (previous.scenery.size() == view.scenery.size()) {
+        for (size_t i = 0; i < view.scenery.size(); ++i) {
+            blendRect(view.scenery[i].rect, previous.scenery[i].rect, alpha);
+        }
+    }
+
+    // Same slot and generation means the same projectile in both ticks
+    const ProjectileStore& before = previous.projectiles;
+    ProjectileStore& after = view.projectiles;
+    for (size_t slot = 0; slot < after.span(); ++slot) {
+        if (after.alive[slot] && before.alive[slot] && before.generation[slot] == after.generation[slot]) {
+            after.posX[slot] = lerp(before.posX[slot], after.posX[slot], alpha);
+            after.posY[slot] = lerp(before.posY[slot], after.posY[slot], alpha);
+        }
+    }
+
+    return view;
+}
+
+} // namespace tankduel
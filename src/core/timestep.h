@@ -0,0 +1,23 @@
+// src/core/timestep.h
+#pragma once
+
+#include "constants.h"
+#include "game_state.h"
+
+namespace tankduel {
+
+struct FixedTimestep {
+    double tickSeconds{1.0 / DEFAULT_TICK_RATE};
+    double accumulator{0.0};
+    int maxCatchUpTicks{DEFAULT_MAX_CATCHUP_TICKS};
+};
+
+// Returns how many fixed ticks to run for this frame's elapsed time.
+int consumeFrameTime(FixedTimestep& timestep, double frameSeconds);
+
+// Fraction of a tick left in the accumulator, used to blend snapshots.
+float interpolationAlpha(const FixedTimestep& timestep);
+
+GameState interpolateForRender(const GameState& previous, const GameState& current, float alpha);
+
+} // namespace tankduel
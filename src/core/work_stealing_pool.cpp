@@ -0,0 +1,97 @@
+// src/core/work_stealing_pool.cpp
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace tankduel {
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount) {
+    threadCount = std::max(1u, threadCount);
+    queues_.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers_.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    pending_.fetch_add(1);
+    std::size_t index = nextQueue_.fetch_add(1) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // Taking the sleep lock orders this push before any worker's re-check.
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    workAvailable_.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    allDone_.wait(lock, [this] { return pending_.load() == 0; });
+}
+
+bool WorkStealingPool::popLocal(std::size_t index, Task& task) {
+    WorkerQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(std::size_t thief, Task& task) {
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+        WorkerQueue& victim = *queues_[(thief + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(std::size_t index) {
+    for (;;) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            task();
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(sleepMutex_);
+                allDone_.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        if (stopping_) return;
+        // Re-check under the lock: submit() takes it after pushing, so a task
+        // queued since our scan cannot slip past this wait.
+        bool queued = std::any_of(queues_.begin(), queues_.end(), [](const std::unique_ptr<WorkerQueue>& queue) {
+            std::lock_guard<std::mutex> queueLock(queue->mutex);
+            return !queue->tasks.empty();
+        });
+        if (!queued) {
+            workAvailable_.wait(lock);
+        }
+    }
+}
+
+} // namespace tankduel
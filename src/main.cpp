@@ -3,123 +3,49 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <cctype>
-#include <random>
+#include <cstdint>
+#include <memory>
+#include <cstdio>
 #include <string>
 #include <vector>
 #include <cstdlib>
 
-namespace {
-constexpr int LOGICAL_WIDTH  = 640;
-constexpr int LOGICAL_HEIGHT = 384;
-constexpr int DEFAULT_WINDOW_SCALE = 2;
-
-constexpr float DEFAULT_LAUNCH_SPEED   = 160.0f;
-constexpr float MIN_LAUNCH_SPEED       = 90.0f;
-constexpr float MAX_LAUNCH_SPEED       = 260.0f;
-constexpr float POWER_ADJUST_RATE      = 110.0f;
-
-constexpr int DAMAGE_MORTAR            = 24;
-constexpr int DAMAGE_CLUSTER           = 16;
-constexpr int DAMAGE_CLUSTER_SHARD     = 12;
-constexpr int DAMAGE_NAPALM_DIRECT     = 18;
-constexpr int DAMAGE_GRENADE           = 20;
-constexpr int DAMAGE_DIRTGUN           = 0;
-constexpr int TANK_HP = 100;
-constexpr float RELOAD_TIME = 0.45f;
-constexpr float GRAVITY = 120.0f;
-constexpr float TURRET_ROT_SPEED = 120.0f;
-constexpr float MAX_TURRET_SWING = 90.0f;
-constexpr float DEG2RAD = 0.0174532925f;
-constexpr float PI = 3.14159265f;
-
-constexpr float TERRAIN_BASELINE = LOGICAL_HEIGHT - 70.0f;
-
-constexpr float TANK_COLLISION_WIDTH = 9.0f;
-constexpr float TANK_COLLISION_HEIGHT = 5.0f;
-
-constexpr float TANK_SCALE = 0.28f;
-
-constexpr float HULL_TEXTURE_WIDTH = 72.0f;
-constexpr float HULL_TEXTURE_HEIGHT = 28.0f;
-constexpr float HULL_DRAW_WIDTH = HULL_TEXTURE_WIDTH * TANK_SCALE;
-constexpr float HULL_DRAW_HEIGHT = HULL_TEXTURE_HEIGHT * TANK_SCALE;
-constexpr float HULL_OFFSET_X = (HULL_DRAW_WIDTH - TANK_COLLISION_WIDTH) * 0.5f;
-constexpr float HULL_OFFSET_Y = 10.0f * TANK_SCALE;
-
-constexpr float TURRET_TEXTURE_WIDTH = 64.0f;
-constexpr float TURRET_TEXTURE_HEIGHT = 24.0f;
-constexpr float TURRET_DRAW_WIDTH = TURRET_TEXTURE_WIDTH * TANK_SCALE;
-constexpr float TURRET_DRAW_HEIGHT = TURRET_TEXTURE_HEIGHT * TANK_SCALE;
-constexpr float TURRET_PIVOT_X = 18.0f * TANK_SCALE;
-constexpr float TURRET_PIVOT_Y = 16.0f * TANK_SCALE;
-
-constexpr float TURRET_PIVOT_WORLD_OFFSET_Y = -1.4f;
-constexpr float MUZZLE_LENGTH = 32.0f * TANK_SCALE;
-
-constexpr float RADIUS_MORTAR = 3.2f;
-constexpr float RADIUS_CLUSTER = 3.0f;
-constexpr float RADIUS_CLUSTER_SHARD = 2.2f;
-constexpr float RADIUS_NAPALM = 3.8f;
-constexpr float RADIUS_GRENADE = 2.8f;
-constexpr float RADIUS_DIRTGUN = 2.5f;
-
-constexpr float CLUSTER_SPLIT_TIME = 0.45f;
-constexpr float CLUSTER_SPREAD = 0.22f;
-
-constexpr float NAPALM_BURN_DURATION = 1.2f;
-constexpr float NAPALM_EROSION_RATE = 32.0f;
-constexpr float EXPLOSION_DURATION = 0.45f;
-constexpr float TANK_EXPLOSION_DURATION = 1.2f;
-
-constexpr int GLYPH_WIDTH = 6;
-constexpr int GLYPH_HEIGHT = 7;
-constexpr int DEFAULT_GLYPH_PIXEL = 3;
+#include "core/bot_planner.h"
+#include "core/game_state.h"
+#include "core/profiler.h"
+#include "core/simulation.h"
+#include "core/threat.h"
+#include "core/timestep.h"
+#include "core/work_stealing_pool.h"
+#include "render/render_stats.h"
+#include "render/terrain_canvas.h"
+#include "render/text.h"
 
-enum class ProjectileKind { Mortar, Cluster, ClusterShard, Napalm, Grenade, Dirtgun };
+using namespace tankduel;
 
-enum class SceneryKind { Tower };
-
-enum class GameMode { OnePlayer, TwoPlayer };
-
-enum class Difficulty { Easy, Medium, Hard };
-
-enum class PlayMode { TurnBased, FreeForAll };
-
-enum class GameScreen { Menu, DifficultySelect, ModeSelect, Playing, Paused, Help };
-
-std::mt19937& rng() {
-    static std::mt19937 engine{ std::random_device{}() };
-    return engine;
-}
+namespace {
+constexpr int DEFAULT_WINDOW_SCALE = 2;
+constexpr int BOT_ROLLOUT_SAMPLES = 8;  // full-physics shots per ammo kind
 
-float randomFloat(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(rng());
-}
+// SDL scancode for each simulation key, indexed by Key.
+constexpr std::array<SDL_Scancode, static_cast<size_t>(Key::Count)> KEY_SCANCODES{
+    SDL_SCANCODE_Q, SDL_SCANCODE_A, SDL_SCANCODE_W, SDL_SCANCODE_S, SDL_SCANCODE_E,
+    SDL_SCANCODE_R, SDL_SCANCODE_SPACE, SDL_SCANCODE_I, SDL_SCANCODE_K, SDL_SCANCODE_O,
+    SDL_SCANCODE_L, SDL_SCANCODE_P, SDL_SCANCODE_U, SDL_SCANCODE_RETURN
+};
 
-ProjectileKind nextAmmoType(ProjectileKind current) {
-    switch (current) {
-        case ProjectileKind::Mortar: return ProjectileKind::Cluster;
-        case ProjectileKind::Cluster: return ProjectileKind::Napalm;
-        case ProjectileKind::Napalm: return ProjectileKind::Grenade;
-        case ProjectileKind::Grenade: return ProjectileKind::Dirtgun;
-        case ProjectileKind::Dirtgun: return ProjectileKind::Mortar;
-        case ProjectileKind::ClusterShard: return ProjectileKind::Mortar;
+InputState readKeyboard() {
+    PROFILE_FUNCTION();
+    const Uint8* keys = SDL_GetKeyboardState(nullptr);
+    InputState input;
+    for (size_t i = 0; i < KEY_SCANCODES.size(); ++i) {
+        input.down[i] = keys[KEY_SCANCODES[i]] != 0;
     }
-    return ProjectileKind::Mortar;
+    return input;
 }
 
-const char* ammoDisplayName(ProjectileKind kind) {
-    switch (kind) {
-        case ProjectileKind::Mortar: return "Mortar";
-        case ProjectileKind::Cluster: return "Cluster";
-        case ProjectileKind::Napalm: return "Napalm";
-        case ProjectileKind::Grenade: return "Grenade";
-        case ProjectileKind::Dirtgun: return "Dirtgun";
-        case ProjectileKind::ClusterShard: return "Cluster";
-    }
-    return "Mortar";
+SDL_FRect toSDLRect(const Rect& rect) {
+    return SDL_FRect{ rect.x, rect.y, rect.w, rect.h };
 }
 
 struct Assets {
@@ -244,181 +170,6 @@ bool loadAssets(SDL_Renderer* renderer, Assets& assets) {
     return true;
 }
 
-struct Projectile {
-    SDL_FPoint position{};
-    SDL_FPoint velocity{};
-    float radius{RADIUS_MORTAR};
-    ProjectileKind kind{};
-    int damage{};
-    int owner{};
-    bool alive{true};
-    float age{0.0f};
-    bool spawnedChildren{false};
-    int bouncesRemaining{0};
-};
-
-struct Explosion {
-    SDL_FPoint position{};
-    float timer{EXPLOSION_DURATION};
-    float duration{EXPLOSION_DURATION};
-    float maxRadius{22.0f};
-    bool isTankExplosion{false};
-};
-
-struct NapalmPatch {
-    SDL_FPoint position{};
-    float radius{28.0f};
-    float currentRadius{0.0f};
-    float timer{NAPALM_BURN_DURATION};
-};
-
-struct SceneryObject {
-    SDL_FRect rect{};
-    SceneryKind kind{};
-    float health{100.0f};
-    float maxHealth{100.0f};
-    bool alive{true};
-    float verticalVelocity{0.0f};
-    bool falling{false};
-};
-
-struct Tank {
-    SDL_FRect rect{};
-    float turretAngleDeg{45.0f};
-    float reloadTimer{0.0f};
-    float launchSpeed{DEFAULT_LAUNCH_SPEED};
-    float verticalVelocity{0.0f};
-    ProjectileKind selected{ProjectileKind::Mortar};
-    int hp{TANK_HP};
-    SDL_Scancode aimUp{};
-    SDL_Scancode aimDown{};
-    SDL_Scancode powerUp{};
-    SDL_Scancode powerDown{};
-    SDL_Scancode fire{};
-    SDL_Scancode nextAmmo{};
-    SDL_Scancode activateForceField{};
-    int id{};
-    bool facingRight{true};
-    bool exploding{false};
-    float explosionTimer{0.0f};
-    bool ammoSwitchHeld{false};
-    bool forceFieldKeyHeld{false};
-    int shotsFired{0};
-    bool forceFieldActive{false};
-    bool forceFieldAvailable{true};
-    float forceFieldRadius{35.0f};
-};
-
-struct GameState {
-    Tank player1{};
-    Tank player2{};
-    std::vector<Projectile> projectiles{};
-    std::vector<Explosion> explosions{};
-    std::vector<NapalmPatch> napalmPatches{};
-    std::vector<SceneryObject> scenery{};
-    std::vector<int> terrainHeights{};
-    std::vector<int> terrainSubstrate{};
-    bool matchOver{false};
-    int winner{0};
-    float resetTimer{2.0f};
-
-    // Turn-based system
-    int currentPlayer{1};  // 1 or 2
-    bool waitingForTurnEnd{false};
-    float turnEndTimer{0.0f};
-    bool shotFired{false};
-
-    // Menu and game mode system
-    GameScreen currentScreen{GameScreen::Menu};
-    GameMode gameMode{GameMode::TwoPlayer};
-    Difficulty difficulty{Difficulty::Medium};
-    PlayMode playMode{PlayMode::TurnBased};
-    int menuSelection{0};  // 0 = 1 Player, 1 = 2 Player
-    int pauseMenuSelection{0};  // 0 = Continue, 1 = Quit Game
-
-    // Bot AI system
-    bool isPlayer2Bot{false};
-    float botThinkTimer{0.0f};
-    float botTargetAngle{45.0f};
-    float botTargetPower{DEFAULT_LAUNCH_SPEED};
-    ProjectileKind botTargetAmmo{ProjectileKind::Mortar};
-    bool botReadyToFire{false};
-};
-
-SDL_FRect makeTankRect(float x, float y) {
-    return SDL_FRect{ x, y, TANK_COLLISION_WIDTH, TANK_COLLISION_HEIGHT };
-}
-
-float terrainHeightAt(const std::vector<int>& heights, float x) {
-    if (heights.empty()) return static_cast<float>(LOGICAL_HEIGHT - 1);
-    float clamped = std::clamp(x, 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
-    int x0 = static_cast<int>(std::floor(clamped));
-    int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
-    float t = clamped - static_cast<float>(x0);
-    return static_cast<float>(heights[x0]) + (static_cast<float>(heights[x1]) - static_cast<float>(heights[x0])) * t;
-}
-
-float substrateHeightAt(const std::vector<int>& substrate, float x) {
-    if (substrate.empty()) return static_cast<float>(LOGICAL_HEIGHT - 1);
-    float clamped = std::clamp(x, 0.0f, static_cast<float>(LOGICAL_WIDTH - 1));
-    int x0 = static_cast<int>(std::floor(clamped));
-    int x1 = std::min(x0 + 1, LOGICAL_WIDTH - 1);
-    float t = clamped - static_cast<float>(x0);
-    return static_cast<float>(substrate[x0]) + (static_cast<float>(substrate[x1]) - static_cast<float>(substrate[x0])) * t;
-}
-
-void generateTerrain(std::vector<int>& surface, std::vector<int>& substrate) {
-    surface.resize(LOGICAL_WIDTH);
-    substrate.resize(LOGICAL_WIDTH);
-
-    const int segments = 10;
-    std::array<float, segments + 1> controls{};
-    const float baseLine = TERRAIN_BASELINE - randomFloat(4.0f, 10.0f);
-    for (int i = 0; i <= segments; ++i) {
-        controls[i] = baseLine + randomFloat(-8.0f, 8.0f);
-    }
-
-    for (int v = 0; v < 2; ++v) {
-        int idx = std::clamp(static_cast<int>(randomFloat(1.0f, static_cast<float>(segments - 1))), 1, segments - 1);
-        controls[idx] += randomFloat(28.0f, 40.0f);
-    }
-    for (int c = 0; c < 2; ++c) {
-        int idx = std::clamp(static_cast<int>(randomFloat(1.0f, static_cast<float>(segments - 1))), 1, segments - 1);
-        controls[idx] -= randomFloat(18.0f, 30.0f);
-    }
-
-    float segmentWidth = static_cast<float>(LOGICAL_WIDTH) / segments;
-    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
-        float fx = static_cast<float>(x);
-        int seg = std::min(static_cast<int>(fx / segmentWidth), segments - 1);
-        float t = (fx - seg * segmentWidth) / segmentWidth;
-        float start = controls[seg];
-        float end = controls[seg + 1];
-        float base = start + (end - start) * t;
-        base += std::sin(fx * 0.07f + controls[seg] * 0.02f) * 3.0f;
-        base += std::sin(fx * 0.18f + controls[seg + 1] * 0.015f) * 2.0f;
-        surface[x] = static_cast<int>(std::round(base));
-    }
-
-    for (int pass = 0; pass < 2; ++pass) {
-        std::vector<int> temp = surface;
-        for (int x = 1; x < LOGICAL_WIDTH - 1; ++x) {
-            temp[x] = static_cast<int>(std::round(surface[x] * 0.6f + surface[x - 1] * 0.2f + surface[x + 1] * 0.2f));
-        }
-        surface.swap(temp);
-    }
-
-    for (int& h : surface) {
-        h = std::clamp(h, LOGICAL_HEIGHT - 118, LOGICAL_HEIGHT - 32);
-    }
-
-    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
-        float substrateBase = static_cast<float>(surface[x]) + randomFloat(14.0f, 22.0f);
-        substrate[x] = static_cast<int>(std::round(std::min(substrateBase, static_cast<float>(LOGICAL_HEIGHT - 14))));
-        substrate[x] = std::max(substrate[x], surface[x] + 10);
-    }
-}
-
 SDL_Color palette(int index) {
     switch (index) {
         case 0: return SDL_Color{ 34, 17, 51, 255 };
@@ -431,816 +182,138 @@ SDL_Color palette(int index) {
     }
 }
 
-float turretWorldAngleDeg(const Tank& tank) {
-    return tank.facingRight ? tank.turretAngleDeg : (180.0f - tank.turretAngleDeg);
-}
-
-Projectile spawnProjectile(const Tank& tank) {
-    Projectile proj;
-    proj.kind = tank.selected;
-    proj.owner = tank.id;
-
-    float speed = tank.launchSpeed;
-    switch (proj.kind) {
-        case ProjectileKind::Mortar:
-            proj.damage = DAMAGE_MORTAR;
-            proj.radius = RADIUS_MORTAR;
-            break;
-        case ProjectileKind::Cluster:
-            proj.damage = DAMAGE_CLUSTER;
-            proj.radius = RADIUS_CLUSTER;
-            speed *= 1.05f;
-            break;
-        case ProjectileKind::Napalm:
-            proj.damage = DAMAGE_NAPALM_DIRECT;
-            proj.radius = RADIUS_NAPALM;
-            speed *= 1.1f;
-            break;
-        case ProjectileKind::Grenade:
-            proj.damage = DAMAGE_GRENADE;
-            proj.radius = RADIUS_GRENADE;
-            proj.bouncesRemaining = 3;
-            speed *= 1.0f;
-            break;
-        case ProjectileKind::ClusterShard:
-            proj.damage = DAMAGE_CLUSTER_SHARD;
-            proj.radius = RADIUS_CLUSTER_SHARD;
-            speed *= 0.9f;
-            proj.spawnedChildren = true;
-            break;
-        case ProjectileKind::Dirtgun:
-            proj.damage = DAMAGE_DIRTGUN;
-            proj.radius = RADIUS_DIRTGUN;
-            speed *= 1.1f;
-            break;
-    }
-
-    float angleDeg = turretWorldAngleDeg(tank);
-    float angleRad = angleDeg * DEG2RAD;
-    float pivotX = tank.rect.x + tank.rect.w * 0.5f;
-    float pivotY = tank.rect.y + TURRET_PIVOT_WORLD_OFFSET_Y;
-
-    proj.position.x = pivotX + std::cos(angleRad) * MUZZLE_LENGTH;
-    proj.position.y = pivotY - std::sin(angleRad) * MUZZLE_LENGTH;
-    proj.velocity = SDL_FPoint{
-        std::cos(angleRad) * speed,
-        -std::sin(angleRad) * speed
-    };
-
-    return proj;
-}
-
-void updateTank(Tank& tank, const Uint8* keys, float dt, std::vector<Projectile>& projectiles, bool isCurrentPlayer, GameState& state) {
-    if (tank.reloadTimer > 0.0f) {
-        tank.reloadTimer -= dt;
-        if (tank.reloadTimer < 0.0f) tank.reloadTimer = 0.0f;
-    }
-
-    // Only allow input if it's this player's turn and not waiting for turn end
-    if (isCurrentPlayer && !state.waitingForTurnEnd) {
-        if (keys[tank.aimUp]) tank.turretAngleDeg += TURRET_ROT_SPEED * dt;
-        if (keys[tank.aimDown]) tank.turretAngleDeg -= TURRET_ROT_SPEED * dt;
-
-        tank.turretAngleDeg = std::clamp(tank.turretAngleDeg, 0.0f, MAX_TURRET_SWING);
-
-        if (keys[tank.powerUp])   tank.launchSpeed += POWER_ADJUST_RATE * dt;
-        if (keys[tank.powerDown]) tank.launchSpeed -= POWER_ADJUST_RATE * dt;
-        tank.launchSpeed = std::clamp(tank.launchSpeed, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
-
-        if (keys[tank.nextAmmo]) {
-            if (!tank.ammoSwitchHeld) {
-                tank.selected = nextAmmoType(tank.selected);
-                tank.ammoSwitchHeld = true;
-            }
-        } else {
-            tank.ammoSwitchHeld = false;
-        }
-
-        // Firing logic depends on play mode
-        bool canFire = keys[tank.fire] && tank.reloadTimer <= 0.0f;
-        if (state.playMode == PlayMode::FreeForAll) {
-            // In free-for-all, any player can fire anytime (no turn restrictions)
-            if (canFire) {
-                projectiles.push_back(spawnProjectile(tank));
-                tank.reloadTimer = RELOAD_TIME;
-
-                // Increment shot count and make force field available every 5 shots
-                tank.shotsFired++;
-                if (tank.shotsFired % 5 == 0) {
-                    tank.forceFieldAvailable = true;
-                }
-            }
-        } else {
-            // Turn-based: only allow firing if it's the player's turn and they haven't fired yet
-            if (canFire && !state.shotFired) {
-                projectiles.push_back(spawnProjectile(tank));
-                tank.reloadTimer = RELOAD_TIME;
-                state.shotFired = true;
-                state.waitingForTurnEnd = true;
-                state.turnEndTimer = 3.0f; // Wait 3 seconds to see projectile impact before switching turns
-
-                // Increment shot count and make force field available every 5 shots
-                tank.shotsFired++;
-                if (tank.shotsFired % 5 == 0) {
-                    tank.forceFieldAvailable = true;
-                }
-            }
-        }
-    } else {
-        // Reset ammo switch state for non-active players
-        tank.ammoSwitchHeld = false;
-    }
-
-    // Force field activation is available to all players regardless of turn (for free-for-all mode)
-    if (keys[tank.activateForceField]) {
-        if (!tank.forceFieldKeyHeld && tank.forceFieldAvailable && !tank.forceFieldActive) {
-            tank.forceFieldActive = true;
-            tank.forceFieldAvailable = false;
-            tank.forceFieldKeyHeld = true;
-        }
-    } else {
-        tank.forceFieldKeyHeld = false;
-    }
-}
-
-bool circleIntersectsRect(const SDL_FPoint& center, float radius, const SDL_FRect& rect) {
-    float closestX = std::clamp(center.x, rect.x, rect.x + rect.w);
-    float closestY = std::clamp(center.y, rect.y, rect.y + rect.h);
-    float dx = center.x - closestX;
-    float dy = center.y - closestY;
-    return (dx * dx + dy * dy) <= radius * radius;
-}
-
-SDL_FRect tankHitbox(const Tank& tank) {
-    SDL_FRect hit = tank.rect;
-    float extraWidth = HULL_DRAW_WIDTH * 0.45f;
-    hit.x -= extraWidth * 0.5f;
-    hit.w += extraWidth;
-    float extraTop = TURRET_DRAW_HEIGHT * 0.85f;
-    hit.y -= extraTop;
-    hit.h += extraTop;
-    return hit;
-}
-
-void deformTerrain(std::vector<int>& terrain, float centerX, float radius, float depth);
-
-float sceneryMaxHealth(SceneryKind kind) {
-    (void)kind;
-    return 120.0f;
-}
-
-void erodeTerrainLayers(GameState& state, float centerX, float radius, float depth);
-
-void destroySceneryObject(GameState& state, SceneryObject& object, const SDL_FPoint& impact) {
-    if (!object.alive) return;
-    object.alive = false;
-    float radius = 26.0f;
-    float depth = 14.0f;
-    erodeTerrainLayers(state, object.rect.x + object.rect.w * 0.5f, radius, depth);
-    state.explosions.push_back({ impact, 0.5f, 0.5f, radius + 6.0f, false });
-}
-
-void damageSceneryObject(GameState& state, SceneryObject& object, float amount, const SDL_FPoint& impact) {
-    if (!object.alive) return;
-    object.health -= amount;
-    float scarDepth = std::max(2.0f, amount * 0.15f);
-    erodeTerrainLayers(state, impact.x, std::max(object.rect.w * 0.25f, 10.0f), scarDepth);
-    if (object.health <= 0.0f) {
-        destroySceneryObject(state, object, impact);
-    }
-}
-
-void erodeTerrainLayers(GameState& state, float centerX, float radius, float depth) {
-    deformTerrain(state.terrainHeights, centerX, radius, depth);
-    deformTerrain(state.terrainSubstrate, centerX, radius * 0.7f, depth * 0.35f);
-    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
-    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
-    for (int x = start; x <= end; ++x) {
-        if (x >= 0 && x < static_cast<int>(state.terrainHeights.size()) && x < static_cast<int>(state.terrainSubstrate.size())) {
-            state.terrainHeights[x] = std::min(state.terrainHeights[x], state.terrainSubstrate[x] - 2);
-        }
-    }
-}
-
-void carveCircularCrater(GameState& state, float centerX, float radius, float depth) {
-    if (radius <= 0.0f || depth <= 0.0f) return;
-    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
-    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
-    float radiusSq = radius * radius;
-    for (int x = start; x <= end; ++x) {
-        float dx = static_cast<float>(x) - centerX;
-        float distSq = dx * dx;
-        if (distSq > radiusSq) continue;
-        float normalized = distSq / radiusSq;
-        float drop = depth * std::sqrt(std::max(0.0f, 1.0f - normalized));
-        if (x < static_cast<int>(state.terrainHeights.size())) {
-            state.terrainHeights[x] = std::min(LOGICAL_HEIGHT - 8, state.terrainHeights[x] + static_cast<int>(std::round(drop)));
-        }
-        if (x < static_cast<int>(state.terrainSubstrate.size())) {
-            state.terrainSubstrate[x] = std::min(LOGICAL_HEIGHT - 6, state.terrainSubstrate[x] + static_cast<int>(std::round(drop * 0.35f)));
-            state.terrainSubstrate[x] = std::max(state.terrainSubstrate[x], state.terrainHeights[x] + 8);
-        }
-    }
-}
-
-float clampPosition(float value, float halfWidth) {
-    return std::clamp(value, halfWidth + 4.0f, static_cast<float>(LOGICAL_WIDTH) - halfWidth - 4.0f);
-}
-
-void addSceneryObject(GameState& state, SceneryKind kind, float centerX) {
-    float width = randomFloat(20.0f, 28.0f);
-    float height = randomFloat(78.0f, 108.0f);
-
-    float halfWidth = width * 0.5f;
-    float clampedCenter = clampPosition(centerX, halfWidth);
-    float left = clampedCenter - halfWidth;
-    float groundLeft = terrainHeightAt(state.terrainHeights, left);
-    float groundRight = terrainHeightAt(state.terrainHeights, left + width);
-    float support = std::min(groundLeft, groundRight);
-    float top = support - height;
-
-    SceneryObject object;
-    object.rect = SDL_FRect{ left, top, width, height };
-    object.kind = kind;
-    object.maxHealth = sceneryMaxHealth(kind);
-    object.health = object.maxHealth;
-    object.alive = true;
-    object.verticalVelocity = 0.0f;
-    object.falling = false;
-    state.scenery.push_back(object);
+void drawRect(SDL_Renderer* renderer, SDL_FRect rect, SDL_Color color) {
+    ++renderStats().drawCalls;
+    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, 255);
+    SDL_RenderFillRectF(renderer, &rect);
 }
 
-void generateSceneryObjects(GameState& state) {
-    state.scenery.clear();
-    constexpr float MIN_DISTANCE_BETWEEN_TOWERS = 110.0f;
-    constexpr float TANK_CLEAR_ZONE = 110.0f;
-    std::vector<float> selected;
-    std::array<float, 2> tankCenters{
-        56.0f + TANK_COLLISION_WIDTH * 0.5f,
-        static_cast<float>(LOGICAL_WIDTH) - 72.0f + TANK_COLLISION_WIDTH * 0.5f
-    };
-
-    auto isValid = [&](float candidate) {
-        for (float center : tankCenters) {
-            if (std::abs(candidate - center) < TANK_CLEAR_ZONE) return false;
-        }
-        for (float existing : selected) {
-            if (std::abs(candidate - existing) < MIN_DISTANCE_BETWEEN_TOWERS) return false;
-        }
-        return true;
-    };
+// Untextured triangles gathered across draw functions and submitted with one
+// SDL_RenderGeometry call, so the call count does not grow with entity count.
+// Everything in a batch is drawn with the renderer's blend mode.
+struct GeometryBatch {
+    std::vector<SDL_Vertex> vertices{};
+    std::vector<int> indices{};
+};
 
-    const int desiredTowers = 3;
-    for (int i = 0; i < desiredTowers; ++i) {
-        bool placed = false;
-        for (int attempt = 0; attempt < 20 && !placed; ++attempt) {
-            float candidate = randomFloat(80.0f, static_cast<float>(LOGICAL_WIDTH) - 80.0f);
-            if (!isValid(candidate)) continue;
-            selected.push_back(candidate);
-            placed = true;
-        }
-    }
+constexpr int MIN_CIRCLE_SEGMENTS = 8;
+constexpr int MAX_CIRCLE_SEGMENTS = 64;
 
-    for (float center : selected) {
-        addSceneryObject(state, SceneryKind::Tower, center);
-    }
+int circleSegments(float radius) {
+    return std::clamp(static_cast<int>(std::ceil(radius * 1.5f)), MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
 }
 
-void addTerrainMound(GameState& state, float centerX, float radius, float height) {
-    if (radius <= 0.0f || height <= 0.0f) return;
-    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
-    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
-    float radiusSq = radius * radius;
-
-    for (int x = start; x <= end; ++x) {
-        float dx = static_cast<float>(x) - centerX;
-        float distSq = dx * dx;
-        if (distSq > radiusSq) continue;
-        float normalized = distSq / radiusSq;
-        float addition = height * std::sqrt(std::max(0.0f, 1.0f - normalized));
-
-        if (x >= 0 && x < static_cast<int>(state.terrainHeights.size())) {
-            state.terrainHeights[x] = std::max(LOGICAL_HEIGHT - 140, static_cast<int>(state.terrainHeights[x] - addition));
-            state.terrainHeights[x] = std::min(LOGICAL_HEIGHT - 20, state.terrainHeights[x]);
-        }
-        if (x >= 0 && x < static_cast<int>(state.terrainSubstrate.size())) {
-            state.terrainSubstrate[x] = std::max(LOGICAL_HEIGHT - 140, static_cast<int>(state.terrainSubstrate[x] - addition * 0.7f));
-            state.terrainSubstrate[x] = std::min(LOGICAL_HEIGHT - 20, state.terrainSubstrate[x]);
+// Unit circle points for each segment count, built on first use
+const std::vector<SDL_FPoint>& unitCircle(int segments) {
+    static std::array<std::vector<SDL_FPoint>, MAX_CIRCLE_SEGMENTS + 1> tables;
+    std::vector<SDL_FPoint>& table = tables[segments];
+    if (table.empty()) {
+        for (int i = 0; i < segments; ++i) {
+            float angle = 2.0f * PI * static_cast<float>(i) / static_cast<float>(segments);
+            table.push_back(SDL_FPoint{ std::cos(angle), std::sin(angle) });
         }
     }
-}
-
-void deformTerrain(std::vector<int>& terrain, float centerX, float radius, float depth) {
-    if (terrain.empty()) return;
-    int start = std::max(0, static_cast<int>(std::floor(centerX - radius - 2.0f)));
-    int end = std::min(LOGICAL_WIDTH - 1, static_cast<int>(std::ceil(centerX + radius + 2.0f)));
-    for (int x = start; x <= end; ++x) {
-        float dx = static_cast<float>(x) - centerX;
-        float dist = std::abs(dx);
-        if (dist > radius) continue;
-        float t = dist / radius;
-        float falloff = (1.0f - t * t);
-        float delta = depth * falloff;
-        terrain[x] = std::min(LOGICAL_HEIGHT - 8, terrain[x] + static_cast<int>(std::round(delta)));
-    }
-    for (int& h : terrain) {
-        h = std::clamp(h, LOGICAL_HEIGHT - 140, LOGICAL_HEIGHT - 20);
-    }
-}
-
-void applyGravityToTank(Tank& tank, const std::vector<int>& terrain, float dt) {
-    constexpr float GRAVITY_ACC = 260.0f;
-    float leftSample = terrainHeightAt(terrain, tank.rect.x + tank.rect.w * 0.25f);
-    float rightSample = terrainHeightAt(terrain, tank.rect.x + tank.rect.w * 0.75f);
-    float support = std::min(leftSample, rightSample);
-    float bottom = tank.rect.y + tank.rect.h;
-
-    float gap = support - bottom;
-    if (gap > 0.5f) {
-        tank.verticalVelocity += GRAVITY_ACC * dt;
-        tank.rect.y += tank.verticalVelocity * dt;
-    } else if (gap < -0.5f) {
-        tank.rect.y = support - tank.rect.h - 0.5f;
-        tank.verticalVelocity = 0.0f;
-    } else {
-        tank.rect.y = support - tank.rect.h;
-        tank.verticalVelocity = 0.0f;
-    }
-
-    float newBottom = tank.rect.y + tank.rect.h;
-    if (newBottom >= support - 0.2f && tank.verticalVelocity > 0.0f && gap <= 0.5f) {
-        tank.rect.y = support - tank.rect.h;
-        tank.verticalVelocity = 0.0f;
-    }
-
-    if (tank.rect.y + tank.rect.h > LOGICAL_HEIGHT - 2) {
-        tank.rect.y = LOGICAL_HEIGHT - 2 - tank.rect.h;
-        tank.verticalVelocity = 0.0f;
-    }
-}
-
-void applyGravityToScenery(SceneryObject& object, const std::vector<int>& terrain, float dt) {
-    if (!object.alive) return;
-
-    constexpr float GRAVITY_ACC = 260.0f;
-    constexpr float SUPPORT_THRESHOLD = 2.0f;
-
-    // Sample terrain at multiple points under the tower for stability
-    float leftSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.1f);
-    float centerSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.5f);
-    float rightSample = terrainHeightAt(terrain, object.rect.x + object.rect.w * 0.9f);
-
-    // Tower needs support from at least two points to remain stable
-    float support1 = std::min(leftSample, centerSample);
-    float support2 = std::min(centerSample, rightSample);
-    float support = std::max(support1, support2);
-
-    float bottom = object.rect.y + object.rect.h;
-    float gap = support - bottom;
-
-    // Check if tower should start falling due to lack of support
-    if (gap > SUPPORT_THRESHOLD && !object.falling) {
-        object.falling = true;
-        object.verticalVelocity = 0.0f;
-    }
-
-    // Apply physics if falling
-    if (object.falling) {
-        object.verticalVelocity += GRAVITY_ACC * dt;
-        object.rect.y += object.verticalVelocity * dt;
-
-        // Check for landing
-        if (gap <= 0.5f && object.verticalVelocity > 0.0f) {
-            object.rect.y = support - object.rect.h;
-            object.verticalVelocity = 0.0f;
-            object.falling = false;
+    return table;
+}
+
+void addDisc(GeometryBatch& batch, float cx, float cy, float radius, SDL_Color color) {
+    if (radius <= 0.0f || color.a == 0) return;
+    const std::vector<SDL_FPoint>& circle = unitCircle(circleSegments(radius));
+    const int center = static_cast<int>(batch.vertices.size());
+    const int segments = static_cast<int>(circle.size());
+    batch.vertices.push_back(SDL_Vertex{ { cx, cy }, color, { 0.0f, 0.0f } });
+    for (const SDL_FPoint& p : circle) {
+        batch.vertices.push_back(SDL_Vertex{ { cx + p.x * radius, cy + p.y * radius }, color, { 0.0f, 0.0f } });
+    }
+    for (int i = 0; i < segments; ++i) {
+        batch.indices.push_back(center);
+        batch.indices.push_back(center + 1 + i);
+        batch.indices.push_back(center + 1 + (i + 1) % segments);
+    }
+}
+
+void addRing(GeometryBatch& batch, float cx, float cy, float innerRadius, float outerRadius, SDL_Color color) {
+    if (outerRadius <= 0.0f || color.a == 0) return;
+    innerRadius = std::max(0.0f, innerRadius);
+    const std::vector<SDL_FPoint>& circle = unitCircle(circleSegments(outerRadius));
+    const int base = static_cast<int>(batch.vertices.size());
+    const int segments = static_cast<int>(circle.size());
+    for (const SDL_FPoint& p : circle) {
+        batch.vertices.push_back(SDL_Vertex{ { cx + p.x * innerRadius, cy + p.y * innerRadius }, color, { 0.0f, 0.0f } });
+        batch.vertices.push_back(SDL_Vertex{ { cx + p.x * outerRadius, cy + p.y * outerRadius }, color, { 0.0f, 0.0f } });
+    }
+    for (int i = 0; i < segments; ++i) {
+        int next = (i + 1) % segments;
+        int in0 = base + 2 * i;
+        int out0 = in0 + 1;
+        int in1 = base + 2 * next;
+        int out1 = in1 + 1;
+        for (int corner : { in0, out0, out1, in0, out1, in1 }) {
+            batch.indices.push_back(corner);
         }
-    } else if (gap > 0.5f) {
-        // Tower is not falling but terrain has eroded slightly - settle down
-        object.rect.y = support - object.rect.h;
-    }
-
-    // Destroy tower if it falls off the world
-    if (object.rect.y > LOGICAL_HEIGHT) {
-        object.alive = false;
     }
 }
 
-void updateProjectiles(GameState& state, float dt) {
-    std::vector<Projectile> spawned;
-    for (auto& proj : state.projectiles) {
-        if (!proj.alive) continue;
-
-        proj.age += dt;
-
-        if (proj.kind == ProjectileKind::Cluster && !proj.spawnedChildren && proj.age >= CLUSTER_SPLIT_TIME) {
-            float speedMag = std::sqrt(proj.velocity.x * proj.velocity.x + proj.velocity.y * proj.velocity.y);
-            float baseAngle = std::atan2(proj.velocity.y, proj.velocity.x);
-            for (int i = -1; i <= 1; ++i) {
-                float spread = CLUSTER_SPREAD * static_cast<float>(i);
-                float newAngle = baseAngle + spread;
-                float newSpeed = speedMag * randomFloat(0.88f, 1.02f);
-                Projectile shard;
-                shard.kind = ProjectileKind::ClusterShard;
-                shard.owner = proj.owner;
-                shard.damage = DAMAGE_CLUSTER_SHARD;
-                shard.radius = RADIUS_CLUSTER_SHARD;
-                shard.position = proj.position;
-                shard.velocity.x = std::cos(newAngle) * newSpeed;
-                shard.velocity.y = std::sin(newAngle) * newSpeed;
-                shard.spawnedChildren = true;
-                spawned.push_back(shard);
-            }
-            state.explosions.push_back({proj.position, 0.25f, 0.25f, 14.0f, false});
-            proj.alive = false;
-            continue;
-        }
-
-        bool hitScenery = false;
-        for (auto& object : state.scenery) {
-            if (!object.alive) continue;
-            if (circleIntersectsRect(proj.position, proj.radius, object.rect)) {
-                float dmg = static_cast<float>(proj.damage);
-                if (proj.kind == ProjectileKind::Napalm) {
-                    dmg *= 0.7f;
-                }
-                damageSceneryObject(state, object, dmg, proj.position);
-                state.explosions.push_back({proj.position, EXPLOSION_DURATION * 0.8f, EXPLOSION_DURATION * 0.8f, 20.0f, false});
-                if (proj.kind == ProjectileKind::Napalm) {
-                    float napalmRadius = 32.0f;
-                    float napalmDepth = 11.0f;
-                    carveCircularCrater(state, proj.position.x, napalmRadius, napalmDepth);
-                    NapalmPatch patch;
-                    patch.position = proj.position;
-                    patch.radius = napalmRadius;
-                    patch.currentRadius = 0.0f;
-                    patch.timer = NAPALM_BURN_DURATION;
-                    state.napalmPatches.push_back(patch);
-                }
-                proj.alive = false;
-                hitScenery = true;
-                break;
-            }
-        }
-        if (hitScenery) {
-            continue;
-        }
-
-        proj.velocity.y += GRAVITY * dt;
-        proj.position.x += proj.velocity.x * dt;
-        proj.position.y += proj.velocity.y * dt;
-
-        // Handle screen boundary collisions
-        bool hitBoundary = false;
-        if (proj.position.x - proj.radius <= 0.0f) {
-            if (proj.kind == ProjectileKind::Grenade && proj.bouncesRemaining > 0) {
-                proj.position.x = proj.radius + 1.0f;
-                proj.velocity.x = -proj.velocity.x * 0.6f;
-                proj.bouncesRemaining--;
-                hitBoundary = true;
-            } else {
-                proj.alive = false;
-                continue;
-            }
-        }
-        if (proj.position.x + proj.radius >= LOGICAL_WIDTH) {
-            if (proj.kind == ProjectileKind::Grenade && proj.bouncesRemaining > 0) {
-                proj.position.x = LOGICAL_WIDTH - proj.radius - 1.0f;
-                proj.velocity.x = -proj.velocity.x * 0.6f;
-                proj.bouncesRemaining--;
-                hitBoundary = true;
-            } else {
-                proj.alive = false;
-                continue;
-            }
-        }
-        if (proj.position.y - proj.radius > LOGICAL_HEIGHT) {
-            proj.alive = false;
-            continue;
-        }
-        // Handle top boundary bounce
-        if (proj.position.y + proj.radius <= 0.0f) {
-            if (proj.kind == ProjectileKind::Grenade && proj.bouncesRemaining > 0) {
-                proj.position.y = -proj.radius + 1.0f;
-                proj.velocity.y = -proj.velocity.y * 0.6f;
-                proj.bouncesRemaining--;
-                hitBoundary = true;
-            } else {
-                proj.alive = false;
-                continue;
-            }
-        }
-
-        if (hitBoundary) {
-            continue; // Skip terrain collision check this frame
-        }
-
-        float terrainY = terrainHeightAt(state.terrainHeights, proj.position.x);
-        if (proj.position.y + proj.radius >= terrainY) {
-            switch (proj.kind) {
-                case ProjectileKind::Mortar:
-                    carveCircularCrater(state, proj.position.x, 24.0f, 14.0f);
-                    break;
-                case ProjectileKind::Cluster:
-                    erodeTerrainLayers(state, proj.position.x, 18.0f, 8.0f);
-                    break;
-                case ProjectileKind::ClusterShard:
-                    erodeTerrainLayers(state, proj.position.x, 12.0f, 6.0f);
-                    break;
-                case ProjectileKind::Napalm: {
-                    float napalmRadius = 34.0f;
-                    float napalmDepth = 12.0f;
-                    carveCircularCrater(state, proj.position.x, napalmRadius, napalmDepth);
-                    NapalmPatch patch;
-                    patch.position = proj.position;
-                    patch.radius = napalmRadius;
-                    patch.currentRadius = 0.0f;
-                    patch.timer = NAPALM_BURN_DURATION;
-                    state.napalmPatches.push_back(patch);
-                    break;
-                }
-                case ProjectileKind::Grenade:
-                    if (proj.bouncesRemaining > 0) {
-                        // Bounce off terrain
-                        proj.bouncesRemaining--;
-                        proj.position.y = terrainY - proj.radius - 1.0f; // Move above ground
-                        proj.velocity.y = -proj.velocity.y * 0.6f; // Bounce with energy loss
-                        proj.velocity.x *= 0.8f; // Reduce horizontal velocity
-                        continue; // Don't explode, keep bouncing
-                    } else {
-                        // No bounces left, explode
-                        erodeTerrainLayers(state, proj.position.x, 16.0f, 8.0f);
-                    }
-                    break;
-                case ProjectileKind::Dirtgun:
-                    addTerrainMound(state, proj.position.x, 50.0f, 20.0f);
-                    break;
-            }
-            state.explosions.push_back({proj.position, EXPLOSION_DURATION, EXPLOSION_DURATION, 24.0f, proj.kind == ProjectileKind::Napalm});
-            proj.alive = false;
-            continue;
-        }
-
-        if (!state.matchOver) {
-            Tank* targets[2] = { &state.player1, &state.player2 };
-            for (Tank* target : targets) {
-                if (proj.owner == target->id) continue;
-
-                // Check for force field collision first
-                if (target->forceFieldActive) {
-                    float tankCenterX = target->rect.x + target->rect.w * 0.5f;
-                    float tankCenterY = target->rect.y + target->rect.h * 0.5f;
-                    float dx = proj.position.x - tankCenterX;
-                    float dy = proj.position.y - tankCenterY;
-                    float distanceSquared = dx * dx + dy * dy;
-                    float forceFieldRadiusSquared = target->forceFieldRadius * target->forceFieldRadius;
-
-                    if (distanceSquared <= forceFieldRadiusSquared) {
-                        // Calculate bounce direction - reflect velocity away from tank center
-                        float distance = std::sqrt(distanceSquared);
-                        if (distance > 0.1f) {
-                            float normalX = dx / distance;
-                            float normalY = dy / distance;
-
-                            // Reflect velocity vector
-                            float dotProduct = proj.velocity.x * normalX + proj.velocity.y * normalY;
-                            proj.velocity.x -= 2.0f * dotProduct * normalX;
-                            proj.velocity.y -= 2.0f * dotProduct * normalY;
-
-                            // Add some bounce energy
-                            proj.velocity.x *= 1.1f;
-                            proj.velocity.y *= 1.1f;
-
-                            // Deactivate force field after use
-                            target->forceFieldActive = false;
-
-                            // Move projectile outside force field to prevent multiple bounces
-                            proj.position.x = tankCenterX + normalX * (target->forceFieldRadius + proj.radius + 2.0f);
-                            proj.position.y = tankCenterY + normalY * (target->forceFieldRadius + proj.radius + 2.0f);
-                        }
-                        continue; // Skip normal collision check
-                    }
-                }
-
-                SDL_FRect hitbox = tankHitbox(*target);
-                if (circleIntersectsRect(proj.position, proj.radius, hitbox)) {
-                    target->hp -= proj.damage;
-                    state.explosions.push_back({proj.position, EXPLOSION_DURATION, EXPLOSION_DURATION, 26.0f, false});
-                    switch (proj.kind) {
-                        case ProjectileKind::Mortar:
-                            carveCircularCrater(state, proj.position.x, 22.0f, 12.0f);
-                            break;
-                        case ProjectileKind::Cluster:
-                        case ProjectileKind::ClusterShard:
-                            erodeTerrainLayers(state, proj.position.x, 16.0f, 8.0f);
-                            break;
-                        case ProjectileKind::Napalm: {
-                            float napalmRadius = 32.0f;
-                            float napalmDepth = 11.0f;
-                            carveCircularCrater(state, proj.position.x, napalmRadius, napalmDepth);
-                            NapalmPatch patch;
-                            patch.position = proj.position;
-                            patch.radius = napalmRadius;
-                            patch.currentRadius = 0.0f;
-                            patch.timer = NAPALM_BURN_DURATION;
-                            state.napalmPatches.push_back(patch);
-                            break;
-                        }
-                        case ProjectileKind::Grenade:
-                            erodeTerrainLayers(state, proj.position.x, 18.0f, 9.0f);
-                            break;
-                        case ProjectileKind::Dirtgun:
-                            addTerrainMound(state, proj.position.x, 50.0f, 20.0f);
-                            break;
-                    }
-                    proj.alive = false;
-                    if (target->hp <= 0) {
-                        target->exploding = true;
-                        target->explosionTimer = TANK_EXPLOSION_DURATION;
-                        state.explosions.push_back({
-                            SDL_FPoint{ target->rect.x + target->rect.w * 0.5f, target->rect.y + target->rect.h * 0.5f },
-                            TANK_EXPLOSION_DURATION,
-                            TANK_EXPLOSION_DURATION,
-                            48.0f,
-                            true
-                        });
-                        erodeTerrainLayers(state, target->rect.x + target->rect.w * 0.5f, 36.0f, 18.0f);
-                        state.matchOver = true;
-                        state.winner = (target->id == 1) ? 2 : 1;
-                        state.resetTimer = 3.0f;
-                    }
-                    break;
-                }
-            }
-        }
-    }
-
-    state.projectiles.erase(
-        std::remove_if(state.projectiles.begin(), state.projectiles.end(),
-                       [](const Projectile& p) { return !p.alive; }),
-        state.projectiles.end());
-
-    if (!spawned.empty()) {
-        state.projectiles.insert(state.projectiles.end(), spawned.begin(), spawned.end());
+void addQuad(GeometryBatch& batch, float x, float y, float w, float h, SDL_Color color) {
+    if (w <= 0.0f || h <= 0.0f || color.a == 0) return;
+    const int base = static_cast<int>(batch.vertices.size());
+    batch.vertices.push_back(SDL_Vertex{ { x, y }, color, { 0.0f, 0.0f } });
+    batch.vertices.push_back(SDL_Vertex{ { x + w, y }, color, { 0.0f, 0.0f } });
+    batch.vertices.push_back(SDL_Vertex{ { x + w, y + h }, color, { 0.0f, 0.0f } });
+    batch.vertices.push_back(SDL_Vertex{ { x, y + h }, color, { 0.0f, 0.0f } });
+    for (int corner : { 0, 1, 2, 0, 2, 3 }) {
+        batch.indices.push_back(base + corner);
     }
 }
 
-void drawRect(SDL_Renderer* renderer, SDL_FRect rect, SDL_Color color) {
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, 255);
-    SDL_RenderFillRectF(renderer, &rect);
-}
-
-void drawFilledCircle(SDL_Renderer* renderer, float cx, float cy, float radius, SDL_Color color) {
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-    int minY = static_cast<int>(std::floor(cy - radius));
-    int maxY = static_cast<int>(std::ceil(cy + radius));
-    for (int y = minY; y <= maxY; ++y) {
-        float dy = cy - static_cast<float>(y);
-        float spanSq = radius * radius - dy * dy;
-        if (spanSq < 0.0f) continue;
-        float dx = std::sqrt(spanSq);
-        int x0 = static_cast<int>(std::floor(cx - dx));
-        int x1 = static_cast<int>(std::ceil(cx + dx));
-        SDL_RenderDrawLine(renderer, x0, y, x1, y);
+void flushGeometry(SDL_Renderer* renderer, GeometryBatch& batch) {
+    PROFILE_FUNCTION();
+    if (!batch.indices.empty()) {
+        ++renderStats().drawCalls;
+        SDL_RenderGeometry(renderer, nullptr, batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                           batch.indices.data(), static_cast<int>(batch.indices.size()));
     }
+    batch.vertices.clear();
+    batch.indices.clear();
 }
 
-using GlyphRows = std::array<uint8_t, GLYPH_HEIGHT>;
-
-constexpr GlyphRows GLYPH_SPACE{ 0,0,0,0,0,0,0 };
-constexpr GlyphRows GLYPH_A{ 0b011110, 0b100001, 0b100001, 0b111111, 0b100001, 0b100001, 0b100001 };
-constexpr GlyphRows GLYPH_B{ 0b111110, 0b100001, 0b100001, 0b111110, 0b100001, 0b100001, 0b111110 };
-constexpr GlyphRows GLYPH_C{ 0b011110, 0b100001, 0b100000, 0b100000, 0b100000, 0b100001, 0b011110 };
-constexpr GlyphRows GLYPH_E{ 0b111111, 0b100000, 0b100000, 0b111110, 0b100000, 0b100000, 0b111111 };
-constexpr GlyphRows GLYPH_G{ 0b011110, 0b100001, 0b100000, 0b101111, 0b100001, 0b100001, 0b011110 };
-constexpr GlyphRows GLYPH_M{ 0b100001, 0b110011, 0b101101, 0b100001, 0b100001, 0b100001, 0b100001 };
-constexpr GlyphRows GLYPH_O{ 0b011110, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b011110 };
-constexpr GlyphRows GLYPH_Q{ 0b011110, 0b100001, 0b100001, 0b100101, 0b100011, 0b100001, 0b011111 };
-constexpr GlyphRows GLYPH_V{ 0b100001, 0b100001, 0b100001, 0b100001, 0b010010, 0b010010, 0b001100 };
-constexpr GlyphRows GLYPH_R{ 0b111110, 0b100001, 0b100001, 0b111110, 0b101000, 0b100100, 0b100011 };
-constexpr GlyphRows GLYPH_T{ 0b111111, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100 };
-constexpr GlyphRows GLYPH_P{ 0b111110, 0b100001, 0b100001, 0b111110, 0b100000, 0b100000, 0b100000 };
-constexpr GlyphRows GLYPH_L{ 0b100000, 0b100000, 0b100000, 0b100000, 0b100000, 0b100000, 0b111111 };
-constexpr GlyphRows GLYPH_U{ 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b011110 };
-constexpr GlyphRows GLYPH_Y{ 0b100001, 0b010010, 0b010010, 0b001100, 0b001100, 0b001100, 0b001100 };
-constexpr GlyphRows GLYPH_W{ 0b100001, 0b100001, 0b100001, 0b100101, 0b101101, 0b110011, 0b100001 };
-constexpr GlyphRows GLYPH_X{ 0b100001, 0b010010, 0b001100, 0b001100, 0b010010, 0b100001, 0b100001 };
-constexpr GlyphRows GLYPH_Z{ 0b111111, 0b000010, 0b000100, 0b001000, 0b010000, 0b100000, 0b111111 };
-constexpr GlyphRows GLYPH_I{ 0b111111, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100, 0b111111 };
-constexpr GlyphRows GLYPH_J{ 0b000001, 0b000001, 0b000001, 0b000001, 0b100001, 0b100001, 0b011110 };
-constexpr GlyphRows GLYPH_N{ 0b100001, 0b110001, 0b101001, 0b100101, 0b100011, 0b100001, 0b100001 };
-constexpr GlyphRows GLYPH_S{ 0b011111, 0b100000, 0b100000, 0b011110, 0b000001, 0b000001, 0b111110 };
-constexpr GlyphRows GLYPH_H{ 0b100001, 0b100001, 0b100001, 0b111111, 0b100001, 0b100001, 0b100001 };
-constexpr GlyphRows GLYPH_F{ 0b111111, 0b100000, 0b100000, 0b111110, 0b100000, 0b100000, 0b100000 };
-constexpr GlyphRows GLYPH_D{ 0b111110, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b111110 };
-constexpr GlyphRows GLYPH_K{ 0b100001, 0b100010, 0b100100, 0b111000, 0b100100, 0b100010, 0b100001 };
-constexpr GlyphRows GLYPH_APOSTROPHE{ 0b001100, 0b001100, 0b011000, 0b000000, 0b000000, 0b000000, 0b000000 };
-constexpr GlyphRows GLYPH_HYPHEN{ 0b000000, 0b000000, 0b000000, 0b111110, 0b000000, 0b000000, 0b000000 };
-constexpr GlyphRows GLYPH_ONE{ 0b001100, 0b011100, 0b001100, 0b001100, 0b001100, 0b001100, 0b111111 };
-constexpr GlyphRows GLYPH_TWO{ 0b011110, 0b100001, 0b000001, 0b000110, 0b001100, 0b011000, 0b111111 };
-
-const GlyphRows* glyphFor(char c) {
-    switch (c) {
-        case 'A': return &GLYPH_A;
-        case 'B': return &GLYPH_B;
-        case 'C': return &GLYPH_C;
-        case 'D': return &GLYPH_D;
-        case 'E': return &GLYPH_E;
-        case 'F': return &GLYPH_F;
-        case 'G': return &GLYPH_G;
-        case 'H': return &GLYPH_H;
-        case 'I': return &GLYPH_I;
-        case 'J': return &GLYPH_J;
-        case 'K': return &GLYPH_K;
-        case 'L': return &GLYPH_L;
-        case 'M': return &GLYPH_M;
-        case 'N': return &GLYPH_N;
-        case 'O': return &GLYPH_O;
-        case 'P': return &GLYPH_P;
-        case 'Q': return &GLYPH_Q;
-        case 'R': return &GLYPH_R;
-        case 'S': return &GLYPH_S;
-        case 'T': return &GLYPH_T;
-        case 'U': return &GLYPH_U;
-        case 'V': return &GLYPH_V;
-        case 'W': return &GLYPH_W;
-        case 'X': return &GLYPH_X;
-        case 'Y': return &GLYPH_Y;
-        case 'Z': return &GLYPH_Z;
-        case '1': return &GLYPH_ONE;
-        case '2': return &GLYPH_TWO;
-        case ' ': return &GLYPH_SPACE;
-        case '\'': return &GLYPH_APOSTROPHE;
-        case '-': return &GLYPH_HYPHEN;
-        default:  return nullptr;
-    }
-}
+// The sky is a per-row gradient, so it is cached as a 1 x LOGICAL_HEIGHT
+// texture stretched over the screen. The animated variant drifts its bands and
+// is regenerated at SKY_ANIMATION_RATE instead of every frame.
+struct SkyBackground {
+    SDL_Texture* texture{};
+    std::array<Uint32, LOGICAL_HEIGHT> rows{};
+    bool stale{true};
+    bool animated{false};
+    float phase{0.0f};
+    float refreshTimer{0.0f};
+};
 
-int drawGlyph(SDL_Renderer* renderer, int x, int y, SDL_Color color, const GlyphRows& glyph, int pixelSize) {
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-    SDL_Rect pixel{ x, y, pixelSize, pixelSize };
-    for (int row = 0; row < GLYPH_HEIGHT; ++row) {
-        pixel.y = y + row * pixelSize;
-        uint8_t bits = glyph[row];
-        for (int col = 0; col < GLYPH_WIDTH; ++col) {
-            pixel.x = x + col * pixelSize;
-            bool filled = (bits & (1 << (GLYPH_WIDTH - 1 - col))) != 0;
-            if (filled) {
-                SDL_RenderFillRect(renderer, &pixel);
-            }
-        }
-    }
-    return GLYPH_WIDTH * pixelSize;
-}
+constexpr float SKY_ANIMATION_RATE = 10.0f;  // regenerations per second
+constexpr float SKY_DRIFT_SPEED = 0.6f;      // band phase, radians per second
 
-int drawText(SDL_Renderer* renderer, int x, int y, const std::string& text, SDL_Color color, int pixelSize = DEFAULT_GLYPH_PIXEL) {
-    int cursor = x;
-    int glyphSpacing = pixelSize + 2;  // Increased from pixelSize + 1
-    int wordSpacing = pixelSize * 3;   // Increased from pixelSize * 2
-    for (char c : text) {
-        if (c == ' ') {
-            cursor += wordSpacing;
-            continue;
-        }
-        const GlyphRows* glyph = glyphFor(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
-        if (!glyph) {
-            cursor += wordSpacing;
-            continue;
-        }
-        cursor += drawGlyph(renderer, cursor, y, color, *glyph, pixelSize);
-        cursor += glyphSpacing;
-    }
-    return cursor - x;
+bool createSkyBackground(SDL_Renderer* renderer, SkyBackground& sky) {
+    sky.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 1, LOGICAL_HEIGHT);
+    sky.stale = true;
+    return sky.texture != nullptr;
 }
 
-int measureText(const std::string& text, int pixelSize = DEFAULT_GLYPH_PIXEL) {
-    int width = 0;
-    int glyphSpacing = pixelSize + 2;  // Increased from pixelSize + 1
-    int wordSpacing = pixelSize * 3;   // Increased from pixelSize * 2
-    for (char c : text) {
-        if (c == ' ') {
-            width += wordSpacing;
-            continue;
-        }
-        const GlyphRows* glyph = glyphFor(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
-        if (glyph) {
-            width += GLYPH_WIDTH * pixelSize + glyphSpacing;
-        } else {
-            width += wordSpacing;
-        }
+void destroySkyBackground(SkyBackground& sky) {
+    if (sky.texture) {
+        SDL_DestroyTexture(sky.texture);
+        sky.texture = nullptr;
     }
-    if (width > 0) width -= glyphSpacing;
-    return width;
 }
 
-void drawBackground(SDL_Renderer* renderer) {
+void refreshSkyBackground(SkyBackground& sky) {
+    PROFILE_FUNCTION();
     SDL_Color duskSkyTop{ 28, 21, 56, 255 };
     SDL_Color duskSkyMid{ 120, 65, 110, 255 };
     SDL_Color duskSkyBottom{ 230, 154, 104, 255 };
 
     for (int y = 0; y < LOGICAL_HEIGHT; ++y) {
         float t = y / static_cast<float>(LOGICAL_HEIGHT - 1);
-        float band = std::sin(t * 12.0f) * 0.06f;
+        float band = std::sin(t * 12.0f + sky.phase) * 0.06f;
         float warpedT = std::clamp(t + band, 0.0f, 1.0f);
         SDL_Color c;
         if (warpedT < 0.5f) {
@@ -1254,64 +327,32 @@ void drawBackground(SDL_Renderer* renderer) {
             c.g = static_cast<Uint8>(duskSkyMid.g + (duskSkyBottom.g - duskSkyMid.g) * u);
             c.b = static_cast<Uint8>(duskSkyMid.b + (duskSkyBottom.b - duskSkyMid.b) * u);
         }
-
-        int wobble = static_cast<int>(std::sin((y * 2.1f) + 0.4f) * 4.0f);
-        SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, 255);
-        SDL_RenderDrawLine(renderer, -8 + wobble, y, LOGICAL_WIDTH + 8 + wobble, y);
+        sky.rows[y] = 0xFF000000u | (c.r << 16) | (c.g << 8) | c.b;
     }
+    ++renderStats().textureUploads;
+    SDL_UpdateTexture(sky.texture, nullptr, sky.rows.data(), static_cast<int>(sizeof(Uint32)));
+    sky.stale = false;
 }
 
-void drawTerrain(SDL_Renderer* renderer, const std::vector<int>& surface, const std::vector<int>& substrate) {
-    SDL_Color bedrock{ 72, 76, 88, 255 };
-    SDL_Color base{ 104, 108, 120, 255 };
-    SDL_Color highlight{ 224, 226, 232, 255 };
-    SDL_Color midTone{ 150, 154, 164, 255 };
-    SDL_Color rimLight{ 242, 244, 248, 255 };
-    SDL_Color striation{ 94, 98, 112, 180 };
-
-    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
-        int top = surface[x];
-        int sub = substrate.empty() ? std::min(LOGICAL_HEIGHT - 12, top + 14) : std::max(surface[x] + 6, substrate[x]);
-        SDL_SetRenderDrawColor(renderer, bedrock.r, bedrock.g, bedrock.b, 255);
-        SDL_RenderDrawLine(renderer, x, sub, x, LOGICAL_HEIGHT);
-
-        SDL_SetRenderDrawColor(renderer, base.r, base.g, base.b, 255);
-        SDL_RenderDrawLine(renderer, x, top, x, sub);
-    }
-
-    SDL_SetRenderDrawColor(renderer, striation.r, striation.g, striation.b, striation.a);
-    for (int x = 0; x < LOGICAL_WIDTH; x += 6) {
-        int top = surface[x];
-        SDL_RenderDrawLine(renderer, x - 2, top + 3, x + 4, top + 8);
-    }
-
-    SDL_SetRenderDrawColor(renderer, midTone.r, midTone.g, midTone.b, 150);
-    for (int x = 0; x < LOGICAL_WIDTH; x += 5) {
-        int top = surface[x];
-        SDL_RenderDrawLine(renderer, x, top + 2, x + 1, top + 6);
-    }
-
-    SDL_SetRenderDrawColor(renderer, highlight.r, highlight.g, highlight.b, 210);
-    for (int x = 0; x < LOGICAL_WIDTH; ++x) {
-        int top = surface[x];
-        SDL_RenderDrawPoint(renderer, x, top);
-        if (x % 7 == 0) {
-            SDL_RenderDrawPoint(renderer, x, top - 1);
+void drawBackground(SDL_Renderer* renderer, SkyBackground& sky, float dt) {
+    PROFILE_FUNCTION();
+    if (sky.animated) {
+        sky.phase = std::fmod(sky.phase + SKY_DRIFT_SPEED * dt, 2.0f * PI);
+        sky.refreshTimer += dt;
+        if (sky.refreshTimer >= 1.0f / SKY_ANIMATION_RATE) {
+            sky.refreshTimer = 0.0f;
+            sky.stale = true;
         }
     }
-
-    SDL_SetRenderDrawColor(renderer, rimLight.r, rimLight.g, rimLight.b, 160);
-    for (int x = 1; x < LOGICAL_WIDTH - 1; ++x) {
-        int current = surface[x];
-        int prev = surface[x - 1];
-        int next = surface[x + 1];
-        if (current <= prev && current <= next) {
-            SDL_RenderDrawPoint(renderer, x, current - 1);
-        }
+    if (sky.stale) {
+        refreshSkyBackground(sky);
     }
+    ++renderStats().drawCalls;
+    SDL_RenderCopy(renderer, sky.texture, nullptr, nullptr);
 }
 
 void drawWatchtower(SDL_Renderer* renderer, const SDL_FRect& rect, float healthRatio, bool falling = false) {
+    PROFILE_FUNCTION();
     // Calculate watchtower proportions
     float baseWidth = rect.w;
     float topWidth = rect.w * 0.7f;
@@ -1490,26 +531,115 @@ void drawWatchtower(SDL_Renderer* renderer, const SDL_FRect& rect, float healthR
     }
 }
 
-void drawScenery(SDL_Renderer* renderer, const std::vector<SceneryObject>& objects) {
-    for (const auto& obj : objects) {
+// Towers are rendered once per health bucket into a cell of a shared atlas
+// target; each frame then costs one textured copy per tower. Cells belong to
+// scenery slots and are redrawn only when the tower's size (a new match), its
+// health bucket or its falling state changes.
+constexpr int TOWER_HEALTH_BUCKETS = 20;  // the 0.4 and 0.7 damage thresholds sit on bucket edges
+constexpr int TOWER_CELL_WIDTH = 48;
+constexpr int TOWER_CELL_HEIGHT = 156;
+constexpr int TOWER_ATLAS_COLUMNS = 8;
+constexpr float TOWER_PAD_X = 10.0f;    // foundation overhangs 10% of the width
+constexpr float TOWER_PAD_TOP = 40.0f;  // guard house and roof rise a third of the height
+
+struct TowerSpriteKey {
+    float w{0.0f};
+    float h{0.0f};
+    int bucket{-1};
+    bool falling{false};
+
+    bool operator==(const TowerSpriteKey& other) const {
+        return w == other.w && h == other.h && bucket == other.bucket && falling == other.falling;
+    }
+};
+
+struct TowerSprites {
+    SDL_Texture* atlas{};
+    std::array<TowerSpriteKey, MAX_SCENERY_OBJECTS> cells{};
+};
+
+bool createTowerSprites(SDL_Renderer* renderer, TowerSprites& sprites) {
+    sprites.cells.fill(TowerSpriteKey{});
+    if (!SDL_RenderTargetSupported(renderer)) return true;  // falls back to immediate drawing
+    const int rows = (MAX_SCENERY_OBJECTS + TOWER_ATLAS_COLUMNS - 1) / TOWER_ATLAS_COLUMNS;
+    sprites.atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                      TOWER_ATLAS_COLUMNS * TOWER_CELL_WIDTH, rows * TOWER_CELL_HEIGHT);
+    if (!sprites.atlas) return false;
+    SDL_SetTextureBlendMode(sprites.atlas, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void destroyTowerSprites(TowerSprites& sprites) {
+    if (sprites.atlas) {
+        SDL_DestroyTexture(sprites.atlas);
+        sprites.atlas = nullptr;
+    }
+}
+
+SDL_Rect towerCell(size_t slot) {
+    return SDL_Rect{ static_cast<int>(slot % TOWER_ATLAS_COLUMNS) * TOWER_CELL_WIDTH,
+                     static_cast<int>(slot / TOWER_ATLAS_COLUMNS) * TOWER_CELL_HEIGHT,
+                     TOWER_CELL_WIDTH, TOWER_CELL_HEIGHT };
+}
+
+void renderTowerSprite(SDL_Renderer* renderer, TowerSprites& sprites, size_t slot, const TowerSpriteKey& key) {
+    PROFILE_FUNCTION();
+    const SDL_Rect cell = towerCell(slot);
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, sprites.atlas);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderFillRect(renderer, &cell);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    SDL_RenderSetClipRect(renderer, &cell);
+    SDL_FRect local{ cell.x + TOWER_PAD_X, cell.y + TOWER_PAD_TOP, key.w, key.h };
+    drawWatchtower(renderer, local, static_cast<float>(key.bucket) / TOWER_HEALTH_BUCKETS, key.falling);
+    SDL_RenderSetClipRect(renderer, nullptr);
+
+    SDL_SetRenderTarget(renderer, previous);
+    sprites.cells[slot] = key;
+}
+
+void drawScenery(SDL_Renderer* renderer, TowerSprites& sprites, const std::vector<SceneryObject>& objects) {
+    PROFILE_FUNCTION();
+    for (size_t slot = 0; slot < objects.size(); ++slot) {
+        const SceneryObject& obj = objects[slot];
         if (!obj.alive) continue;
         float healthRatio = obj.maxHealth > 0.0f ? std::clamp(obj.health / obj.maxHealth, 0.0f, 1.0f) : 1.0f;
 
         if (obj.kind == SceneryKind::Tower) {
-            drawWatchtower(renderer, obj.rect, healthRatio, obj.falling);
+            if (!sprites.atlas || slot >= sprites.cells.size()) {
+                drawWatchtower(renderer, toSDLRect(obj.rect), healthRatio, obj.falling);
+                continue;
+            }
+            // Lower bucket edge, so a tower shows cracks from the same health as before
+            TowerSpriteKey key{ obj.rect.w, obj.rect.h,
+                                static_cast<int>(std::floor(healthRatio * TOWER_HEALTH_BUCKETS)), obj.falling };
+            if (!(sprites.cells[slot] == key)) {
+                ++renderStats().cacheRedraws;
+                renderTowerSprite(renderer, sprites, slot, key);
+            }
+            const SDL_Rect cell = towerCell(slot);
+            SDL_FRect dst{ obj.rect.x - TOWER_PAD_X, obj.rect.y - TOWER_PAD_TOP,
+                           static_cast<float>(TOWER_CELL_WIDTH), static_cast<float>(TOWER_CELL_HEIGHT) };
+            ++renderStats().drawCalls;
+            SDL_RenderCopyF(renderer, sprites.atlas, &cell, &dst);
         }
     }
 }
 
-void drawTank(SDL_Renderer* renderer, const Tank& tank, const Assets& assets, bool isPlayerOne) {
+void drawTank(SDL_Renderer* renderer, GeometryBatch& batch, const Tank& tank, const Assets& assets, bool isPlayerOne) {
+    PROFILE_FUNCTION();
     if (tank.exploding) {
         float fade = std::clamp(tank.explosionTimer / TANK_EXPLOSION_DURATION, 0.0f, 1.0f);
         SDL_Color smoke{ 60, 60, 70, static_cast<Uint8>(fade * 160.0f) };
-        drawFilledCircle(renderer,
-                         tank.rect.x + tank.rect.w * 0.5f,
-                         tank.rect.y + tank.rect.h * 0.5f,
-                         12.0f + (1.0f - fade) * 20.0f,
-                         smoke);
+        addDisc(batch,
+                tank.rect.x + tank.rect.w * 0.5f,
+                tank.rect.y + tank.rect.h * 0.5f,
+                12.0f + (1.0f - fade) * 20.0f,
+                smoke);
         return;
     }
     float wobble = std::sin(SDL_GetTicks() * 0.0035f + (isPlayerOne ? 0.35f : 2.2f)) * 1.2f;
@@ -1535,6 +665,7 @@ void drawTank(SDL_Renderer* renderer, const Tank& tank, const Assets& assets, bo
         static_cast<int>(std::lround(hullDest.w)),
         static_cast<int>(std::lround(hullDest.h))
     };
+    renderStats().drawCalls += 2;
     SDL_RenderCopy(renderer, assets.hull, nullptr, &hullDst);
 
     float pivotWorldX = tank.rect.x + tank.rect.w * 0.5f;
@@ -1555,8 +686,11 @@ void drawTank(SDL_Renderer* renderer, const Tank& tank, const Assets& assets, bo
     SDL_RenderCopyEx(renderer, assets.turret, nullptr, &turretDst, renderAngle, &pivot, SDL_FLIP_NONE);
 }
 
-void drawProjectiles(SDL_Renderer* renderer, const std::vector<Projectile>& projectiles) {
-    for (const auto& proj : projectiles) {
+void drawProjectiles(GeometryBatch& batch, const ProjectileStore& projectiles) {
+    PROFILE_FUNCTION();
+    for (size_t slot = 0; slot < projectiles.span(); ++slot) {
+        if (!projectiles.alive[slot]) continue;
+        const Projectile proj = projectiles.get(slot);
         SDL_Color glow{};
         SDL_Color core{};
         float glowExtra = 1.6f;
@@ -1590,16 +724,17 @@ void drawProjectiles(SDL_Renderer* renderer, const std::vector<Projectile>& proj
                 glowExtra = 1.4f;
                 break;
         }
-        drawFilledCircle(renderer, proj.position.x, proj.position.y, proj.radius + glowExtra, glow);
-        drawFilledCircle(renderer, proj.position.x, proj.position.y, proj.radius, core);
+        addDisc(batch, proj.position.x, proj.position.y, proj.radius + glowExtra, glow);
+        addDisc(batch, proj.position.x, proj.position.y, proj.radius, core);
         if (proj.kind == ProjectileKind::Napalm) {
             SDL_Color ember{ 255, 108, 32, 160 };
-            drawFilledCircle(renderer, proj.position.x, proj.position.y + proj.radius * 0.35f, proj.radius * 0.65f, ember);
+            addDisc(batch, proj.position.x, proj.position.y + proj.radius * 0.35f, proj.radius * 0.65f, ember);
         }
     }
 }
 
-void drawExplosions(SDL_Renderer* renderer, const std::vector<Explosion>& explosions) {
+void drawExplosions(GeometryBatch& batch, const ExplosionList& explosions) {
+    PROFILE_FUNCTION();
     for (const auto& explosion : explosions) {
         float lifeT = std::clamp(explosion.timer / explosion.duration, 0.0f, 1.0f);
         float pct = 1.0f - lifeT;
@@ -1611,89 +746,50 @@ void drawExplosions(SDL_Renderer* renderer, const std::vector<Explosion>& explos
         SDL_Color inner = explosion.isTankExplosion
             ? SDL_Color{ 255, 240, 200, alpha }
             : SDL_Color{ 255, 235, 180, alpha };
-        drawFilledCircle(renderer, explosion.position.x, explosion.position.y, radius, outer);
-        drawFilledCircle(renderer, explosion.position.x, explosion.position.y, radius * (explosion.isTankExplosion ? 0.7f : 0.6f), inner);
-    }
-}
-
-void updateExplosions(std::vector<Explosion>& explosions, float dt) {
-    for (auto& explosion : explosions) {
-        explosion.timer -= dt;
+        addDisc(batch, explosion.position.x, explosion.position.y, radius, outer);
+        addDisc(batch, explosion.position.x, explosion.position.y, radius * (explosion.isTankExplosion ? 0.7f : 0.6f), inner);
     }
-    explosions.erase(
-        std::remove_if(explosions.begin(), explosions.end(),
-                       [](const Explosion& e) { return e.timer <= 0.0f; }),
-        explosions.end());
 }
 
-void drawNapalmPatches(SDL_Renderer* renderer, const std::vector<NapalmPatch>& patches) {
+void drawNapalmPatches(GeometryBatch& batch, const NapalmPatchList& patches) {
+    PROFILE_FUNCTION();
     for (const auto& patch : patches) {
         float lifeT = std::clamp(patch.timer / NAPALM_BURN_DURATION, 0.0f, 1.0f);
         float radius = std::max(patch.currentRadius, patch.radius * 0.25f);
         SDL_Color outer{ 255, 120, 48, static_cast<Uint8>(lifeT * 120.0f) };
         SDL_Color inner{ 255, 190, 96, static_cast<Uint8>(lifeT * 200.0f) };
-        drawFilledCircle(renderer, patch.position.x, patch.position.y, radius, outer);
-        drawFilledCircle(renderer, patch.position.x, patch.position.y, radius * 0.6f, inner);
+        addDisc(batch, patch.position.x, patch.position.y, radius, outer);
+        addDisc(batch, patch.position.x, patch.position.y, radius * 0.6f, inner);
     }
 }
 
-void updateNapalmPatches(GameState& state, float dt) {
-    for (auto& patch : state.napalmPatches) {
-        if (patch.timer <= 0.0f) continue;
-        float growth = (patch.radius / std::max(0.2f, NAPALM_BURN_DURATION)) * dt * 1.4f;
-        patch.currentRadius = std::min(patch.radius, patch.currentRadius + growth);
-        patch.timer -= dt;
-    }
-
-    state.napalmPatches.erase(
-        std::remove_if(state.napalmPatches.begin(), state.napalmPatches.end(),
-                       [](const NapalmPatch& p) { return p.timer <= 0.0f; }),
-        state.napalmPatches.end());
-}
-
-void drawForceField(SDL_Renderer* renderer, const Tank& tank) {
+void drawForceField(GeometryBatch& batch, const Tank& tank) {
+    PROFILE_FUNCTION();
     float centerX = tank.rect.x + tank.rect.w * 0.5f;
     float centerY = tank.rect.y + tank.rect.h * 0.5f;
     float radius = tank.forceFieldRadius;
 
-    // Draw the force field as a bluish semi-transparent circle using basic SDL drawing
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-    // Draw multiple concentric circles for a glowing effect
+    // Concentric one-pixel bluish rings, brighter towards the inside, for a glow
     for (int r = static_cast<int>(radius); r >= static_cast<int>(radius - 5); r--) {
         Uint8 alpha = static_cast<Uint8>(20 + (radius - r) * 15);
-        SDL_SetRenderDrawColor(renderer, 100, 150, 255, alpha);
-
-        // Draw circle using Bresenham's circle algorithm
-        int x = 0;
-        int y = r;
-        int d = 3 - 2 * r;
-
-        while (y >= x) {
-            // Draw 8 octants
-            SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            SDL_RenderDrawPoint(renderer, centerX - x, centerY + y);
-            SDL_RenderDrawPoint(renderer, centerX + x, centerY - y);
-            SDL_RenderDrawPoint(renderer, centerX - x, centerY - y);
-            SDL_RenderDrawPoint(renderer, centerX + y, centerY + x);
-            SDL_RenderDrawPoint(renderer, centerX - y, centerY + x);
-            SDL_RenderDrawPoint(renderer, centerX + y, centerY - x);
-            SDL_RenderDrawPoint(renderer, centerX - y, centerY - x);
-
-            if (d < 0)
-                d = d + 4 * x + 6;
-            else {
-                d = d + 4 * (x - y) + 10;
-                y--;
-            }
-            x++;
-        }
+        addRing(batch, centerX, centerY, r - 0.5f, r + 0.5f, SDL_Color{ 100, 150, 255, alpha });
     }
+}
 
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+// Red ring on the shield's radius, firming up as the predicted crossing nears,
+// and a dot where the shot will cross it
+void drawIncomingThreat(GeometryBatch& batch, const Tank& tank, const IncomingThreat& threat) {
+    if (!threat.incoming()) return;
+    float centerX = tank.rect.x + tank.rect.w * 0.5f;
+    float centerY = tank.rect.y + tank.rect.h * 0.5f;
+    float urgency = 1.0f - std::clamp(threat.timeToImpact / THREAT_HORIZON, 0.0f, 1.0f);
+    Uint8 alpha = static_cast<Uint8>(60.0f + urgency * 160.0f);
+    addRing(batch, centerX, centerY, tank.forceFieldRadius - 1.0f, tank.forceFieldRadius, SDL_Color{ 255, 70, 50, alpha });
+    addDisc(batch, threat.entry.x, threat.entry.y, 2.0f, SDL_Color{ 255, 200, 80, alpha });
 }
 
 void drawUI(SDL_Renderer* renderer, const GameState& state) {
+    PROFILE_FUNCTION();
     SDL_SetRenderDrawColor(renderer, palette(4).r, palette(4).g, palette(4).b, 255);
     SDL_RenderDrawLine(renderer, 12, 24, LOGICAL_WIDTH - 12, 24);
 
@@ -1799,6 +895,7 @@ void drawUI(SDL_Renderer* renderer, const GameState& state) {
 }
 
 void drawBanner(SDL_Renderer* renderer, int winner) {
+    PROFILE_FUNCTION();
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
     SDL_Rect banner{ 64, LOGICAL_HEIGHT / 2 - 36, LOGICAL_WIDTH - 128, 72 };
     SDL_RenderFillRect(renderer, &banner);
@@ -1821,9 +918,7 @@ void drawBanner(SDL_Renderer* renderer, int winner) {
 }
 
 void drawMenu(SDL_Renderer* renderer, const GameState& state) {
-    // Draw background
-    drawBackground(renderer);
-
+    PROFILE_FUNCTION();
     // Title Banner Design
     const std::string gameTitle = "TANK DUEL";
     int titlePixelSize = 5;
@@ -1951,8 +1046,7 @@ void drawMenu(SDL_Renderer* renderer, const GameState& state) {
 }
 
 void drawDifficultyMenu(SDL_Renderer* renderer, const GameState& state) {
-    drawBackground(renderer);
-
+    PROFILE_FUNCTION();
     const std::string title = "SELECT DIFFICULTY";
     SDL_Color titleColor{ 255, 236, 180, 255 };
     SDL_Color selectedColor{ 255, 255, 100, 255 };
@@ -1999,8 +1093,7 @@ void drawDifficultyMenu(SDL_Renderer* renderer, const GameState& state) {
 }
 
 void drawModeMenu(SDL_Renderer* renderer, const GameState& state) {
-    drawBackground(renderer);
-
+    PROFILE_FUNCTION();
     const std::string title = "SELECT GAME MODE";
     SDL_Color titleColor{ 255, 236, 180, 255 };
     SDL_Color selectedColor{ 255, 255, 100, 255 };
@@ -2046,12 +1139,11 @@ void drawModeMenu(SDL_Renderer* renderer, const GameState& state) {
 }
 
 void drawPauseMenu(SDL_Renderer* renderer, const GameState& state) {
+    PROFILE_FUNCTION();
     // Draw semi-transparent overlay over the game
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
     SDL_Rect overlay = {0, 0, LOGICAL_WIDTH, LOGICAL_HEIGHT};
     SDL_RenderFillRect(renderer, &overlay);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
     // Pause menu title
     const std::string title = "GAME PAUSED";
@@ -2098,8 +1190,7 @@ void drawPauseMenu(SDL_Renderer* renderer, const GameState& state) {
 }
 
 void drawHelpMenu(SDL_Renderer* renderer, const GameState& state) {
-    drawBackground(renderer);
-
+    PROFILE_FUNCTION();
     // Title
     const std::string title = "CONTROLS HELP";
     SDL_Color titleColor{255, 255, 100, 255};
@@ -2180,416 +1271,230 @@ void drawHelpMenu(SDL_Renderer* renderer, const GameState& state) {
     drawText(renderer, instructX, 360, instruct, instructColor, 1);
 }
 
-void positionTankOnTerrain(Tank& tank, const std::vector<int>& terrain) {
-    float centerX = tank.rect.x + tank.rect.w * 0.5f;
-    float surfaceY = terrainHeightAt(terrain, centerX);
-    tank.rect.y = surfaceY - tank.rect.h;
-    tank.verticalVelocity = 0.0f;
-}
-
-// Bot AI functions
-float calculateOptimalAngle(const Tank& botTank, const Tank& targetTank, float power) {
-    // Calculate distance and height difference
-    float botX = botTank.rect.x + botTank.rect.w * 0.5f;
-    float targetX = targetTank.rect.x + targetTank.rect.w * 0.5f;
-    float botY = botTank.rect.y + botTank.rect.h * 0.5f;
-    float targetY = targetTank.rect.y + targetTank.rect.h * 0.5f;
-
-    float dx = targetX - botX;
-    float dy = targetY - botY;
-
-    // Improved physics-based calculation for optimal trajectory
-    const float gravity = GRAVITY;
-    float velocity = power;
-    float velocitySq = velocity * velocity;
-
-    // Use proper ballistic formula: angle = 0.5 * arcsin((g * range) / v^2) + height compensation
-    float range = std::abs(dx);
-    if (velocitySq <= 0.0f) return 45.0f;
-
-    // Calculate base angle for flat trajectory
-    float discriminant = velocitySq * velocitySq - gravity * (gravity * range * range + 2.0f * velocitySq * dy);
-
-    if (discriminant < 0.0f) {
-        // Target unreachable with this power, use 45 degrees
-        return 45.0f;
+// Everything the HUD and menu screens display. The retained UI layer is
+// redrawn only when this changes; otherwise it is one composite per frame.
+struct UiLayerKey {
+    GameScreen screen{};
+    int menuSelection{0};
+    int pauseMenuSelection{0};
+    int currentPlayer{0};
+    bool waitingForTurnEnd{false};
+    bool matchOver{false};
+    int winner{0};
+    std::array<int, 2> hp{};
+    std::array<ProjectileKind, 2> selected{};
+    std::array<float, 2> launchSpeed{};
+    std::array<bool, 2> forceFieldActive{};
+    std::array<bool, 2> forceFieldAvailable{};
+
+    bool operator==(const UiLayerKey& other) const {
+        return screen == other.screen && menuSelection == other.menuSelection &&
+               pauseMenuSelection == other.pauseMenuSelection && currentPlayer == other.currentPlayer &&
+               waitingForTurnEnd == other.waitingForTurnEnd && matchOver == other.matchOver &&
+               winner == other.winner && hp == other.hp && selected == other.selected &&
+               launchSpeed == other.launchSpeed && forceFieldActive == other.forceFieldActive &&
+               forceFieldAvailable == other.forceFieldAvailable;
     }
+};
 
-    // Use the lower angle solution for more direct shot
-    float angle1 = std::atan((velocitySq - std::sqrt(discriminant)) / (gravity * range));
-    float angle2 = std::atan((velocitySq + std::sqrt(discriminant)) / (gravity * range));
-
-    // Choose the angle that's within turret limits
-    float angleDeg1 = angle1 * (180.0f / M_PI);
-    float angleDeg2 = angle2 * (180.0f / M_PI);
-
-    float finalAngle = (angleDeg1 >= 0 && angleDeg1 <= MAX_TURRET_SWING) ? angleDeg1 : angleDeg2;
+UiLayerKey makeUiLayerKey(const GameState& state) {
+    UiLayerKey key;
+    key.screen = state.currentScreen;
+    key.menuSelection = state.menuSelection;
+    key.pauseMenuSelection = state.pauseMenuSelection;
+    key.currentPlayer = state.currentPlayer;
+    key.waitingForTurnEnd = state.waitingForTurnEnd;
+    key.matchOver = state.matchOver;
+    key.winner = state.winner;
+    const std::array<const Tank*, 2> tanks{ &state.player1, &state.player2 };
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        key.hp[i] = tanks[i]->hp;
+        key.selected[i] = tanks[i]->selected;
+        key.launchSpeed[i] = tanks[i]->launchSpeed;
+        key.forceFieldActive[i] = tanks[i]->forceFieldActive;
+        key.forceFieldAvailable[i] = tanks[i]->forceFieldAvailable;
+    }
+    return key;
+}
+
+struct UiLayer {
+    SDL_Texture* texture{};
+    UiLayerKey key{};
+    bool valid{false};
+    bool premultiplied{false};
+};
 
-    // If facing left, angles are measured differently
-    if (!botTank.facingRight) {
-        finalAngle = 180.0f - finalAngle;
+// Drawing into a transparent target with plain blending darkens translucent
+// fills once more when the layer is composited; premultiplied alpha keeps
+// the result identical to drawing on screen. Renderers without custom blend
+// modes (the software one) fall back to plain blending.
+const SDL_BlendMode UI_LAYER_DRAW_BLEND = SDL_ComposeCustomBlendMode(
+    SDL_BLENDFACTOR_SRC_ALPHA, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+    SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+const SDL_BlendMode UI_LAYER_COMPOSITE_BLEND = SDL_ComposeCustomBlendMode(
+    SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+    SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+
+bool createUiLayer(SDL_Renderer* renderer, UiLayer& layer) {
+    layer.valid = false;
+    if (!SDL_RenderTargetSupported(renderer)) return true;  // falls back to immediate drawing
+    layer.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                      LOGICAL_WIDTH, LOGICAL_HEIGHT);
+    if (!layer.texture) return false;
+    layer.premultiplied = SDL_SetTextureBlendMode(layer.texture, UI_LAYER_COMPOSITE_BLEND) == 0;
+    if (!layer.premultiplied) {
+        SDL_SetTextureBlendMode(layer.texture, SDL_BLENDMODE_BLEND);
     }
-
-    return std::clamp(finalAngle, 5.0f, MAX_TURRET_SWING - 5.0f);
+    return true;
 }
 
-float calculateOptimalPower(const Tank& botTank, const Tank& targetTank) {
-    float botX = botTank.rect.x + botTank.rect.w * 0.5f;
-    float targetX = targetTank.rect.x + targetTank.rect.w * 0.5f;
-    float botY = botTank.rect.y + botTank.rect.h * 0.5f;
-    float targetY = targetTank.rect.y + targetTank.rect.h * 0.5f;
-
-    float dx = targetX - botX;
-    float dy = targetY - botY;
-    float range = std::abs(dx);
-
-    // Physics-based power calculation
-    const float gravity = GRAVITY;
-    const float targetAngle = 45.0f; // Use 45 degrees as reference angle for power calculation
-    const float angleRad = targetAngle * (M_PI / 180.0f);
-
-    // Calculate required velocity using ballistic formula
-    // v = sqrt(g * range / sin(2 * angle)) for flat trajectory
-    // Add height compensation for dy
-    float basePower = std::sqrt(gravity * range / std::sin(2.0f * angleRad));
-
-    // Height compensation
-    if (dy != 0) {
-        // Adjust power based on height difference
-        float heightFactor = 1.0f + (dy / range) * 0.5f;
-        basePower *= heightFactor;
+void destroyUiLayer(UiLayer& layer) {
+    if (layer.texture) {
+        SDL_DestroyTexture(layer.texture);
+        layer.texture = nullptr;
     }
-
-    // Ensure power is within reasonable bounds
-    basePower = std::clamp(basePower, MIN_LAUNCH_SPEED * 0.8f, MAX_LAUNCH_SPEED * 1.2f);
-
-    return std::clamp(basePower, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
+    layer.valid = false;
 }
 
-bool isTrajectoryBlocked(const GameState& state, const Tank& shooter, const Tank& target, float angle, float power) {
-    float shooterX = shooter.rect.x + shooter.rect.w * 0.5f;
-    float shooterY = shooter.rect.y + shooter.rect.h * 0.5f;
-    float targetX = target.rect.x + target.rect.w * 0.5f;
-    float targetY = target.rect.y + target.rect.h * 0.5f;
-
-    // Calculate trajectory using physics simulation
-    float angleRad = angle * (M_PI / 180.0f);
-    float vx = std::cos(angleRad) * power;
-    float vy = std::sin(angleRad) * power;
-
-    // Adjust direction based on tank facing
-    if (!shooter.facingRight) {
-        vx = -vx;
-    }
-
-    float x = shooterX;
-    float y = shooterY;
-    const float dt = 0.016f; // 60 FPS simulation steps
-    const float gravity = GRAVITY;
-    const float projectileRadius = 3.0f; // Average projectile size
-
-    // Simulate trajectory for reasonable time/distance
-    for (int steps = 0; steps < 600; steps++) {
-        // Update position
-        x += vx * dt;
-        y += vy * dt;
-        vy += gravity * dt;
-
-        // Check if we've gone past the target horizontally
-        float distToTarget = std::abs(x - targetX);
-        if (distToTarget < 8.0f) {
-            // Close to target, trajectory is clear
-            return false;
-        }
-
-        // Check if projectile has gone too far or too high/low
-        if (x < -50.0f || x > LOGICAL_WIDTH + 50.0f || y > LOGICAL_HEIGHT + 50.0f) {
-            break;
-        }
-
-        // Check terrain collision
-        if (y + projectileRadius >= terrainHeightAt(state.terrainHeights, x)) {
-            // Check if this collision is near the target (acceptable)
-            if (distToTarget < 15.0f) {
-                return false; // Close enough to target
+void drawUiContents(SDL_Renderer* renderer, const GameState& state) {
+    PROFILE_FUNCTION();
+    switch (state.currentScreen) {
+        case GameScreen::Menu: drawMenu(renderer, state); break;
+        case GameScreen::DifficultySelect: drawDifficultyMenu(renderer, state); break;
+        case GameScreen::ModeSelect: drawModeMenu(renderer, state); break;
+        case GameScreen::Help: drawHelpMenu(renderer, state); break;
+        case GameScreen::Playing:
+        case GameScreen::Paused:
+            drawUI(renderer, state);
+            if (state.matchOver) {
+                drawBanner(renderer, state.winner);
             }
-            return true; // Blocked by terrain
-        }
-
-        // Check scenery collision (towers)
-        for (const auto& scenery : state.scenery) {
-            if (!scenery.alive) continue;
-
-            if (x >= scenery.rect.x - projectileRadius &&
-                x <= scenery.rect.x + scenery.rect.w + projectileRadius &&
-                y >= scenery.rect.y - projectileRadius &&
-                y <= scenery.rect.y + scenery.rect.h + projectileRadius) {
-
-                // Check if collision is near target
-                if (distToTarget < 15.0f) {
-                    return false; // Close enough to target
-                }
-                return true; // Blocked by scenery
+            // Draw pause menu overlay if paused
+            if (state.currentScreen == GameScreen::Paused) {
+                drawPauseMenu(renderer, state);
             }
-        }
-    }
-
-    return false; // Path appears clear
-}
-
-float findClearTrajectoryAngle(const GameState& state, const Tank& shooter, const Tank& target, float optimalAngle, float power) {
-    // First check if optimal angle is clear
-    if (!isTrajectoryBlocked(state, shooter, target, optimalAngle, power)) {
-        return optimalAngle;
-    }
-
-    // Try higher angles first (arc over obstacles)
-    for (float angleOffset = 5.0f; angleOffset <= 35.0f; angleOffset += 5.0f) {
-        float highAngle = std::clamp(optimalAngle + angleOffset, 5.0f, MAX_TURRET_SWING - 5.0f);
-        if (!isTrajectoryBlocked(state, shooter, target, highAngle, power)) {
-            return highAngle;
-        }
-    }
-
-    // Try lower angles (more direct shots)
-    for (float angleOffset = 5.0f; angleOffset <= 25.0f; angleOffset += 5.0f) {
-        float lowAngle = std::clamp(optimalAngle - angleOffset, 5.0f, MAX_TURRET_SWING - 5.0f);
-        if (!isTrajectoryBlocked(state, shooter, target, lowAngle, power)) {
-            return lowAngle;
-        }
-    }
-
-    // If no clear path found, return optimal angle anyway (bot will miss but try)
-    return optimalAngle;
-}
-
-ProjectileKind chooseBotAmmo(const GameState& state) {
-    // Simple ammo selection logic
-    float healthRatio = static_cast<float>(state.player1.hp) / static_cast<float>(TANK_HP);
-
-    if (healthRatio > 0.7f) {
-        // Early game - use cluster bombs for area damage
-        return randomFloat(0.0f, 1.0f) > 0.6f ? ProjectileKind::Cluster : ProjectileKind::Mortar;
-    } else if (healthRatio > 0.3f) {
-        // Mid game - mix of weapons
-        float choice = randomFloat(0.0f, 1.0f);
-        if (choice > 0.8f) return ProjectileKind::Napalm;
-        else if (choice > 0.6f) return ProjectileKind::Grenade;
-        else if (choice > 0.3f) return ProjectileKind::Cluster;
-        else return ProjectileKind::Mortar;
-    } else {
-        // Late game - aggressive weapons
-        float choice = randomFloat(0.0f, 1.0f);
-        if (choice > 0.7f) return ProjectileKind::Napalm;
-        else if (choice > 0.4f) return ProjectileKind::Grenade;
-        else return ProjectileKind::Cluster;
+            break;
     }
 }
 
-void updateBotAI(GameState& state, float dt) {
-    if (!state.isPlayer2Bot || state.currentPlayer != 2 || state.waitingForTurnEnd) {
+void drawUiLayer(SDL_Renderer* renderer, UiLayer& layer, const GameState& state) {
+    PROFILE_FUNCTION();
+    if (!layer.texture) {
+        drawUiContents(renderer, state);
         return;
     }
 
-    Tank& bot = state.player2;
-    Tank& target = state.player1;
-
-    state.botThinkTimer += dt;
-
-    // Bot thinking phase (1-3 seconds)
-    if (state.botThinkTimer < randomFloat(1.0f, 3.0f) && !state.botReadyToFire) {
-        // Calculate targets during thinking phase with difficulty-based accuracy
-        state.botTargetPower = calculateOptimalPower(bot, target);
-        state.botTargetAngle = calculateOptimalAngle(bot, target, state.botTargetPower);
-
-        // Check for obstacles and adjust angle if needed
-        state.botTargetAngle = findClearTrajectoryAngle(state, bot, target, state.botTargetAngle, state.botTargetPower);
-
-        // Add inaccuracy based on difficulty to achieve target hit rates
-        float angleError = 0.0f;
-        float powerError = 0.0f;
-        switch (state.difficulty) {
-            case Difficulty::Easy:
-                // Target: ~25% hit rate - large errors (about half as good)
-                angleError = randomFloat(-8.0f, 8.0f);
-                powerError = randomFloat(-25.0f, 25.0f);
-                break;
-            case Difficulty::Medium:
-                // Target: ~65% hit rate - moderate errors
-                angleError = randomFloat(-1.5f, 1.5f);
-                powerError = randomFloat(-6.0f, 6.0f);
-                break;
-            case Difficulty::Hard:
-                // Target: 99%+ hit rate - nearly perfect aim
-                angleError = randomFloat(-0.03f, 0.03f);
-                powerError = randomFloat(-0.2f, 0.2f);
-                break;
-        }
-
-        state.botTargetAngle = std::clamp(state.botTargetAngle + angleError, 0.0f, MAX_TURRET_SWING);
-        state.botTargetPower = std::clamp(state.botTargetPower + powerError, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
-        state.botTargetAmmo = chooseBotAmmo(state);
-        return;
-    }
-
-    if (!state.botReadyToFire) {
-        state.botReadyToFire = true;
-        state.botThinkTimer = 0.0f;
-    }
-
-    // Gradually adjust bot's settings toward targets
-    const float adjustSpeed = 60.0f; // degrees per second for angle
-    const float powerAdjustSpeed = 80.0f; // power units per second
-
-    // Adjust angle
-    float angleDiff = state.botTargetAngle - bot.turretAngleDeg;
-    if (std::abs(angleDiff) > 0.5f) {
-        float angleStep = std::copysign(std::min(adjustSpeed * dt, std::abs(angleDiff)), angleDiff);
-        bot.turretAngleDeg += angleStep;
-        bot.turretAngleDeg = std::clamp(bot.turretAngleDeg, 0.0f, MAX_TURRET_SWING);
-    }
-
-    // Adjust power
-    float powerDiff = state.botTargetPower - bot.launchSpeed;
-    if (std::abs(powerDiff) > 1.0f) {
-        float powerStep = std::copysign(std::min(powerAdjustSpeed * dt, std::abs(powerDiff)), powerDiff);
-        bot.launchSpeed += powerStep;
-        bot.launchSpeed = std::clamp(bot.launchSpeed, MIN_LAUNCH_SPEED, MAX_LAUNCH_SPEED);
-    }
-
-    // Switch to target ammo
-    if (bot.selected != state.botTargetAmmo) {
-        bot.selected = state.botTargetAmmo;
-    }
-
-    // Bot force field activation logic
-    if (bot.forceFieldAvailable && !bot.forceFieldActive) {
-        // Check if player has projectiles in the air that might hit the bot
-        bool incomingProjectile = false;
-        for (const auto& proj : state.projectiles) {
-            if (proj.alive && proj.owner != bot.id) {
-                // Simple check: if projectile is moving toward bot's general area
-                float botCenterX = bot.rect.x + bot.rect.w * 0.5f;
-                float distToBot = std::abs(proj.position.x - botCenterX);
-                if (distToBot < 100.0f && proj.velocity.y > 0) { // Coming down near bot
-                    incomingProjectile = true;
-                    break;
-                }
-            }
-        }
-
-        // Activate shield based on difficulty and situation
-        float activationChance = 0.0f;
-        switch (state.difficulty) {
-            case Difficulty::Easy:
-                activationChance = incomingProjectile ? 0.3f : 0.1f;
-                break;
-            case Difficulty::Medium:
-                activationChance = incomingProjectile ? 0.6f : 0.2f;
-                break;
-            case Difficulty::Hard:
-                activationChance = incomingProjectile ? 0.9f : 0.3f;
-                break;
-        }
-
-        if (randomFloat(0.0f, 1.0f) < activationChance) {
-            bot.forceFieldActive = true;
-            bot.forceFieldAvailable = false;
-        }
-    }
-
-    // Fire when ready and settings are close to targets
-    bool angleReady = std::abs(state.botTargetAngle - bot.turretAngleDeg) < 1.0f;
-    bool powerReady = std::abs(state.botTargetPower - bot.launchSpeed) < 3.0f;
-    bool ammoReady = bot.selected == state.botTargetAmmo;
-
-    if (angleReady && powerReady && ammoReady && bot.reloadTimer <= 0.0f && !state.shotFired) {
-        // Bot fires
-        state.projectiles.push_back(spawnProjectile(bot));
-        bot.reloadTimer = RELOAD_TIME;
-        state.shotFired = true;
-        state.waitingForTurnEnd = true;
-        state.turnEndTimer = 3.0f;
-
-        // Increment bot shot count and make force field available every 5 shots (same as human player)
-        bot.shotsFired++;
-        if (bot.shotsFired % 5 == 0) {
-            bot.forceFieldAvailable = true;
+    const UiLayerKey key = makeUiLayerKey(state);
+    if (!layer.valid || !(layer.key == key)) {
+        ++renderStats().cacheRedraws;
+        SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, layer.texture);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        if (!layer.premultiplied || SDL_SetRenderDrawBlendMode(renderer, UI_LAYER_DRAW_BLEND) != 0) {
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         }
+        drawUiContents(renderer, state);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderTarget(renderer, previous);
+        layer.key = key;
+        layer.valid = true;
+    }
+    ++renderStats().drawCalls;
+    SDL_RenderCopy(renderer, layer.texture, nullptr, nullptr);
+}
+
+// Toggled with F3 (or --perf-hud). Keeps a rolling window of frame times so
+// spikes from cluster bursts, tower collapses or bot thinking stay on screen.
+constexpr int PERF_GRAPH_SAMPLES = 120;
+constexpr float PERF_GRAPH_HEIGHT = 48.0f;
+constexpr float PERF_GRAPH_MAX_MS = 50.0f;
+constexpr float PERF_TARGET_MS = 1000.0f / 60.0f;
+
+struct PerfOverlay {
+    bool visible{false};
+    std::array<float, PERF_GRAPH_SAMPLES> frameMs{};
+    std::array<float, PERF_GRAPH_SAMPLES> simMs{};
+    int next{0};
+    float renderMs{0.0f};
+    RenderStats lastFrame{};
+};
 
-        // Reset bot state for next turn
-        state.botReadyToFire = false;
-        state.botThinkTimer = 0.0f;
-    }
-}
-
-void resetMatch(GameState& state) {
-    generateTerrain(state.terrainHeights, state.terrainSubstrate);
-    generateSceneryObjects(state);
-    state.projectiles.clear();
-    state.explosions.clear();
-    state.napalmPatches.clear();
-    state.matchOver = false;
-    state.winner = 0;
-    state.resetTimer = 2.0f;
-
-    state.player1.rect = makeTankRect(56.0f, 0.0f);
-    state.player2.rect = makeTankRect(LOGICAL_WIDTH - 72.0f, 0.0f);
-
-    positionTankOnTerrain(state.player1, state.terrainHeights);
-    positionTankOnTerrain(state.player2, state.terrainHeights);
-    state.player1.verticalVelocity = 0.0f;
-    state.player2.verticalVelocity = 0.0f;
-
-    state.player1.turretAngleDeg = 45.0f;
-    state.player2.turretAngleDeg = 45.0f;
-
-    state.player1.reloadTimer = 0.0f;
-    state.player2.reloadTimer = 0.0f;
-
-    state.player1.launchSpeed = DEFAULT_LAUNCH_SPEED;
-    state.player2.launchSpeed = DEFAULT_LAUNCH_SPEED;
-
-    state.player1.selected = ProjectileKind::Mortar;
-    state.player2.selected = ProjectileKind::Mortar;
-    state.player1.ammoSwitchHeld = false;
-    state.player2.ammoSwitchHeld = false;
-
-    state.player1.hp = TANK_HP;
-    state.player2.hp = TANK_HP;
-
-    state.player1.exploding = false;
-    state.player2.exploding = false;
-
-    // Reset force field states
-    state.player1.forceFieldActive = false;
-    state.player1.forceFieldAvailable = true;
-    state.player1.forceFieldKeyHeld = false;
-    state.player1.shotsFired = 0;
-    state.player2.forceFieldActive = false;
-    state.player2.forceFieldAvailable = true;
-    state.player2.forceFieldKeyHeld = false;
-    state.player2.shotsFired = 0;
-
-    // Initialize turn-based system
-    state.currentPlayer = 1;  // Player 1 starts
-    state.waitingForTurnEnd = false;
-    state.turnEndTimer = 0.0f;
-    state.shotFired = false;
-
-    // Initialize bot AI if in 1-player mode
-    if (state.gameMode == GameMode::OnePlayer) {
-        state.isPlayer2Bot = true;
-        state.botThinkTimer = 0.0f;
-        state.botTargetAngle = 45.0f;
-        state.botTargetPower = DEFAULT_LAUNCH_SPEED;
-        state.botTargetAmmo = ProjectileKind::Mortar;
-        state.botReadyToFire = false;
-    } else {
-        state.isPlayer2Bot = false;
-    }
-    state.player1.explosionTimer = 0.0f;
-    state.player2.explosionTimer = 0.0f;
+// Stores the finished frame and starts counting the next one.
+void recordPerfFrame(PerfOverlay& perf, float frameMs, float simMs, float renderMs) {
+    perf.frameMs[static_cast<size_t>(perf.next)] = frameMs;
+    perf.simMs[static_cast<size_t>(perf.next)] = simMs;
+    perf.next = (perf.next + 1) % PERF_GRAPH_SAMPLES;
+    perf.renderMs = renderMs;
+    perf.lastFrame = renderStats();
+    renderStats() = RenderStats{};
+}
+
+std::string formatMs(float ms) {
+    char text[16];
+    std::snprintf(text, sizeof(text), "%.1f", ms);
+    return text;
+}
+
+void drawPerfOverlay(SDL_Renderer* renderer, GeometryBatch& batch, const PerfOverlay& perf, const GameState& state) {
+    PROFILE_FUNCTION();
+    constexpr float barWidth = 2.0f;
+    constexpr float lineHeight = GLYPH_HEIGHT + 3.0f;
+    const float panelWidth = PERF_GRAPH_SAMPLES * barWidth + 8.0f;
+    const float panelHeight = PERF_GRAPH_HEIGHT + lineHeight * 4.0f + 12.0f;
+    const float panelX = 4.0f;
+    const float panelY = LOGICAL_HEIGHT - panelHeight - 4.0f;
+    const float graphX = panelX + 4.0f;
+    const float graphBottom = panelY + 4.0f + PERF_GRAPH_HEIGHT;
+    const float pixelsPerMs = PERF_GRAPH_HEIGHT / PERF_GRAPH_MAX_MS;
+
+    addQuad(batch, panelX, panelY, panelWidth, panelHeight, SDL_Color{ 0, 0, 0, 170 });
+
+    // Oldest sample on the left; the simulation share is stacked under the rest
+    float worstMs = 0.0f;
+    for (int i = 0; i < PERF_GRAPH_SAMPLES; ++i) {
+        const size_t sample = static_cast<size_t>((perf.next + i) % PERF_GRAPH_SAMPLES);
+        const float frameMs = perf.frameMs[sample];
+        worstMs = std::max(worstMs, frameMs);
+        const float frameH = std::min(frameMs, PERF_GRAPH_MAX_MS) * pixelsPerMs;
+        const float simH = std::min(perf.simMs[sample] * pixelsPerMs, frameH);
+        const SDL_Color frameColor = frameMs <= PERF_TARGET_MS * 1.05f ? SDL_Color{ 83, 180, 90, 220 }
+                                   : frameMs <= PERF_TARGET_MS * 2.0f  ? SDL_Color{ 220, 200, 60, 220 }
+                                                                        : SDL_Color{ 217, 70, 70, 230 };
+        const float x = graphX + i * barWidth;
+        addQuad(batch, x, graphBottom - frameH, barWidth, frameH - simH, frameColor);
+        addQuad(batch, x, graphBottom - simH, barWidth, simH, SDL_Color{ 90, 140, 255, 230 });
+    }
+    // 60 Hz and 30 Hz budget lines
+    const float graphWidth = PERF_GRAPH_SAMPLES * barWidth;
+    addQuad(batch, graphX, graphBottom - PERF_TARGET_MS * pixelsPerMs, graphWidth, 1.0f, SDL_Color{ 255, 255, 255, 110 });
+    addQuad(batch, graphX, graphBottom - PERF_TARGET_MS * 2.0f * pixelsPerMs, graphWidth, 1.0f, SDL_Color{ 255, 255, 255, 60 });
+    flushGeometry(renderer, batch);
+
+    const size_t latest = static_cast<size_t>((perf.next + PERF_GRAPH_SAMPLES - 1) % PERF_GRAPH_SAMPLES);
+    const float frameMs = perf.frameMs[latest];
+    const SDL_Color textColor{ 230, 218, 190, 255 };
+    const SDL_Color simColor{ 140, 180, 255, 255 };
+    const int textX = static_cast<int>(graphX);
+    int textY = static_cast<int>(graphBottom + 4.0f);
+
+    const std::string frameLine = "FRAME " + formatMs(frameMs) + " MS  FPS " +
+        std::to_string(frameMs > 0.0f ? static_cast<int>(std::lround(1000.0f / frameMs)) : 0) +
+        "  MAX " + formatMs(worstMs);
+    drawText(renderer, textX, textY, frameLine, textColor, 1);
+    textY += static_cast<int>(lineHeight);
+    drawText(renderer, textX, textY, "SIM " + formatMs(perf.simMs[latest]) + " MS", simColor, 1);
+    drawText(renderer, textX + 100, textY, "RENDER " + formatMs(perf.renderMs) + " MS", textColor, 1);
+    textY += static_cast<int>(lineHeight);
+    const std::string countLine = "PROJ " + std::to_string(state.projectiles.size()) +
+        "  EXPL " + std::to_string(state.explosions.size()) +
+        "  NAPALM " + std::to_string(state.napalmPatches.size());
+    drawText(renderer, textX, textY, countLine, textColor, 1);
+    textY += static_cast<int>(lineHeight);
+    const std::string drawLine = "DRAWS " + std::to_string(perf.lastFrame.drawCalls) +
+        "  REDRAWS " + std::to_string(perf.lastFrame.cacheRedraws) +
+        "  UPLOADS " + std::to_string(perf.lastFrame.textureUploads);
+    drawText(renderer, textX, textY, drawLine, textColor, 1);
 }
 
 } // namespace
@@ -2605,6 +1510,11 @@ int main(int argc, char** argv) {
     int windowHeight = LOGICAL_HEIGHT * windowScale;
     bool widthSet = false;
     bool heightSet = false;
+    int tickRate = DEFAULT_TICK_RATE;
+    int maxCatchUpTicks = DEFAULT_MAX_CATCHUP_TICKS;
+    bool animatedSky = false;
+    std::string tracePath;
+    bool perfHud = false;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -2616,9 +1526,26 @@ int main(int argc, char** argv) {
         } else if (arg == "--window-height" && i + 1 < argc) {
             windowHeight = std::max(LOGICAL_HEIGHT, std::atoi(argv[++i]));
             heightSet = true;
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            tickRate = std::clamp(std::atoi(argv[++i]), MIN_TICK_RATE, MAX_TICK_RATE);
+        } else if (arg == "--max-catchup" && i + 1 < argc) {
+            maxCatchUpTicks = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--animated-sky") {
+            animatedSky = true;
+        } else if (arg == "--perf-hud") {
+            perfHud = true;
+        } else if (arg == "--trace" && i + 1 < argc) {
+            tracePath = argv[++i];
         }
     }
 
+    if (!tracePath.empty()) {
+        if (!PROFILER_COMPILED_IN) {
+            SDL_Log("Profiling zones are compiled out (TANK_DUEL_ENABLE_PROFILER=OFF); the trace will be empty");
+        }
+        startProfiling();
+    }
+
     if (!widthSet) {
         windowWidth = LOGICAL_WIDTH * windowScale;
     }
@@ -2657,256 +1584,298 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    SkyBackground sky;
+    sky.animated = animatedSky;
+    TerrainCanvas terrainCanvas;
+    TowerSprites towerSprites;
+    UiLayer uiLayer;
+    if (!createGlyphAtlas(renderer) || !createSkyBackground(renderer, sky) || !createTerrainCanvas(renderer, terrainCanvas) ||
+        !createTowerSprites(renderer, towerSprites) || !createUiLayer(renderer, uiLayer)) {
+        SDL_Log("Failed to create cached textures: %s", SDL_GetError());
+        destroyUiLayer(uiLayer);
+        destroyTowerSprites(towerSprites);
+        destroyTerrainCanvas(terrainCanvas);
+        destroyGlyphAtlas();
+        destroySkyBackground(sky);
+        destroyAssets(assets);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+
+    GeometryBatch geometry;
+    PerfOverlay perf;
+    perf.visible = perfHud;
+    // The single-player bot aims on its own thread so a Hard search never
+    // costs a frame, and picks its ammo by rollouts across the other cores;
+    // with one core it searches in 1 ms slices instead
+    std::unique_ptr<WorkStealingPool> rolloutPool;  // outlives the planner that feeds it
+    std::unique_ptr<BotPlanner> botPlanner;
+    ShotSearch botSearch;
     GameState state;
+    const int cpuCount = SDL_GetCPUCount();
+    if (cpuCount > 1) {
+        botPlanner = std::make_unique<BotPlanner>();
+        rolloutPool = std::make_unique<WorkStealingPool>(static_cast<unsigned>(cpuCount - 1));
+        state.player2Bot.planner = botPlanner.get();
+        state.player2Bot.rolloutSamples = BOT_ROLLOUT_SAMPLES;
+        state.player2Bot.rolloutPool = rolloutPool.get();
+    } else {
+        state.player2Bot.search = &botSearch;
+    }
 
     state.player1.id = 1;
     state.player1.facingRight = true;
-    state.player1.aimUp = SDL_SCANCODE_Q;
-    state.player1.aimDown = SDL_SCANCODE_A;
-    state.player1.powerUp = SDL_SCANCODE_W;
-    state.player1.powerDown = SDL_SCANCODE_S;
-    state.player1.fire = SDL_SCANCODE_SPACE;
-    state.player1.nextAmmo = SDL_SCANCODE_E;
-    state.player1.activateForceField = SDL_SCANCODE_R;
+    state.player1.aimUp = Key::Q;
+    state.player1.aimDown = Key::A;
+    state.player1.powerUp = Key::W;
+    state.player1.powerDown = Key::S;
+    state.player1.fire = Key::Space;
+    state.player1.nextAmmo = Key::E;
+    state.player1.activateForceField = Key::R;
 
     state.player2.id = 2;
     state.player2.facingRight = false;
-    state.player2.aimUp = SDL_SCANCODE_I;
-    state.player2.aimDown = SDL_SCANCODE_K;
-    state.player2.powerUp = SDL_SCANCODE_O;
-    state.player2.powerDown = SDL_SCANCODE_L;
-    state.player2.fire = SDL_SCANCODE_RETURN;
-    state.player2.nextAmmo = SDL_SCANCODE_P;
-    state.player2.activateForceField = SDL_SCANCODE_U;
+    state.player2.aimUp = Key::I;
+    state.player2.aimDown = Key::K;
+    state.player2.powerUp = Key::O;
+    state.player2.powerDown = Key::L;
+    state.player2.fire = Key::Return;
+    state.player2.nextAmmo = Key::P;
+    state.player2.activateForceField = Key::U;
 
     resetMatch(state);
 
+    FixedTimestep timestep;
+    timestep.tickSeconds = 1.0 / tickRate;
+    timestep.maxCatchUpTicks = maxCatchUpTicks;
+    GameState previousState = state;
+
     bool running = true;
-    Uint32 lastTicks = SDL_GetTicks();
+    const Uint64 counterFrequency = SDL_GetPerformanceFrequency();
+    Uint64 lastCounter = SDL_GetPerformanceCounter();
 
     while (running) {
-        SDL_Event evt;
-        while (SDL_PollEvent(&evt)) {
-            if (evt.type == SDL_QUIT) {
-                running = false;
-            }
-
-            // Handle menu input
-            if (evt.type == SDL_KEYDOWN) {
-                if (state.currentScreen == GameScreen::Menu) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
-                        state.menuSelection = (state.menuSelection + 2) % 3; // Go up: 0->2, 1->0, 2->1
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
-                        state.menuSelection = (state.menuSelection + 1) % 3; // Go down: 0->1, 1->2, 2->0
+        PROFILE_ZONE("frame");
+        const GameScreen screenBeforeEvents = state.currentScreen;
+        {
+            PROFILE_ZONE("events");
+            SDL_Event evt;
+            while (SDL_PollEvent(&evt)) {
+                if (evt.type == SDL_QUIT) {
+                    running = false;
+                }
+                if (evt.type == SDL_WINDOWEVENT && evt.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                    sky.stale = true;
+                }
+                if (evt.type == SDL_RENDER_TARGETS_RESET) {
+                    // Target contents are lost; redraw every tower cell on demand
+                    towerSprites.cells.fill(TowerSpriteKey{});
+                    uiLayer.valid = false;
+                }
+                if (evt.type == SDL_RENDER_DEVICE_RESET) {
+                    // Every texture is gone with the device; rebuild the cached layers
+                    destroyUiLayer(uiLayer);
+                    destroyTowerSprites(towerSprites);
+                    destroySkyBackground(sky);
+                    destroyTerrainCanvas(terrainCanvas);
+                    destroyGlyphAtlas();
+                    destroyAssets(assets);
+                    if (!loadAssets(renderer, assets) || !createGlyphAtlas(renderer) || !createSkyBackground(renderer, sky) ||
+                        !createTerrainCanvas(renderer, terrainCanvas) || !createTowerSprites(renderer, towerSprites) ||
+                        !createUiLayer(renderer, uiLayer)) {
+                        SDL_Log("Failed to recreate textures: %s", SDL_GetError());
+                        running = false;
                     }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
-                        if (state.menuSelection == 0) {
-                            // 1 Player
-                            state.gameMode = GameMode::OnePlayer;
-                            state.currentScreen = GameScreen::DifficultySelect;
-                            state.menuSelection = 1; // Default to Medium
-                        } else if (state.menuSelection == 1) {
-                            // 2 Player
-                            state.gameMode = GameMode::TwoPlayer;
-                            state.currentScreen = GameScreen::ModeSelect;
-                            state.menuSelection = 0; // Default to Turn-based
-                        } else if (state.menuSelection == 2) {
-                            // Help
-                            state.currentScreen = GameScreen::Help;
+                }
+
+                if (evt.type == SDL_KEYDOWN && evt.key.keysym.scancode == SDL_SCANCODE_F3 && !evt.key.repeat) {
+                    perf.visible = !perf.visible;
+                }
+
+                // Handle menu input
+                if (evt.type == SDL_KEYDOWN) {
+                    if (state.currentScreen == GameScreen::Menu) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+                            state.menuSelection = (state.menuSelection + 2) % 3; // Go up: 0->2, 1->0, 2->1
                         }
-                    }
-                } else if (state.currentScreen == GameScreen::DifficultySelect) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
-                        state.menuSelection = (state.menuSelection + 2) % 3;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
-                        state.menuSelection = (state.menuSelection + 1) % 3;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
-                        state.difficulty = static_cast<Difficulty>(state.menuSelection);
-                        if (state.gameMode == GameMode::OnePlayer) {
-                            // Single player - start game with bot
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+                            state.menuSelection = (state.menuSelection + 1) % 3; // Go down: 0->1, 1->2, 2->0
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
+                            if (state.menuSelection == 0) {
+                                // 1 Player
+                                state.gameMode = GameMode::OnePlayer;
+                                state.currentScreen = GameScreen::DifficultySelect;
+                                state.menuSelection = 1; // Default to Medium
+                            } else if (state.menuSelection == 1) {
+                                // 2 Player
+                                state.gameMode = GameMode::TwoPlayer;
+                                state.currentScreen = GameScreen::ModeSelect;
+                                state.menuSelection = 0; // Default to Turn-based
+                            } else if (state.menuSelection == 2) {
+                                // Help
+                                state.currentScreen = GameScreen::Help;
+                            }
+                        }
+                    } else if (state.currentScreen == GameScreen::DifficultySelect) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+                            state.menuSelection = (state.menuSelection + 2) % 3;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+                            state.menuSelection = (state.menuSelection + 1) % 3;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
+                            state.difficulty = static_cast<Difficulty>(state.menuSelection);
+                            if (state.gameMode == GameMode::OnePlayer) {
+                                // Single player - start game with bot
+                                state.currentScreen = GameScreen::Playing;
+                                state.playMode = PlayMode::TurnBased; // Single player is always turn-based
+                                resetMatch(state);
+                            } else {
+                                // Two player - this shouldn't happen since 2P goes directly to mode select
+                                state.currentScreen = GameScreen::ModeSelect;
+                                state.menuSelection = 0; // Default to Turn-based
+                            }
+                        }
+                    } else if (state.currentScreen == GameScreen::ModeSelect) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+                            state.menuSelection = (state.menuSelection == 0) ? 1 : 0;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+                            state.menuSelection = (state.menuSelection == 1) ? 0 : 1;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
+                            state.playMode = (state.menuSelection == 0) ? PlayMode::TurnBased : PlayMode::FreeForAll;
                             state.currentScreen = GameScreen::Playing;
-                            state.isPlayer2Bot = true;
-                            state.playMode = PlayMode::TurnBased; // Single player is always turn-based
                             resetMatch(state);
-                        } else {
-                            // Two player - this shouldn't happen since 2P goes directly to mode select
-                            state.currentScreen = GameScreen::ModeSelect;
-                            state.menuSelection = 0; // Default to Turn-based
                         }
-                    }
-                } else if (state.currentScreen == GameScreen::ModeSelect) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
-                        state.menuSelection = (state.menuSelection == 0) ? 1 : 0;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
-                        state.menuSelection = (state.menuSelection == 1) ? 0 : 1;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
-                        state.playMode = (state.menuSelection == 0) ? PlayMode::TurnBased : PlayMode::FreeForAll;
-                        state.currentScreen = GameScreen::Playing;
-                        state.isPlayer2Bot = false; // 2-player mode, no bot
-                        resetMatch(state);
-                    }
-                } else if (state.currentScreen == GameScreen::Playing) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
-                        state.currentScreen = GameScreen::Paused;
-                        state.pauseMenuSelection = 0; // Default to Continue
-                    }
-                } else if (state.currentScreen == GameScreen::Paused) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
-                        state.pauseMenuSelection = (state.pauseMenuSelection == 0) ? 1 : 0;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
-                        state.pauseMenuSelection = (state.pauseMenuSelection == 1) ? 0 : 1;
-                    }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
-                        if (state.pauseMenuSelection == 0) {
-                            // Continue
+                    } else if (state.currentScreen == GameScreen::Playing) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
+                            state.currentScreen = GameScreen::Paused;
+                            state.pauseMenuSelection = 0; // Default to Continue
+                        }
+                    } else if (state.currentScreen == GameScreen::Paused) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_W || evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+                            state.pauseMenuSelection = (state.pauseMenuSelection == 0) ? 1 : 0;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_S || evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+                            state.pauseMenuSelection = (state.pauseMenuSelection == 1) ? 0 : 1;
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE || evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
+                            if (state.pauseMenuSelection == 0) {
+                                // Continue
+                                state.currentScreen = GameScreen::Playing;
+                            } else {
+                                // Quit Game
+                                state.currentScreen = GameScreen::Menu;
+                                state.menuSelection = 0; // Reset main menu
+                            }
+                        }
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
+                            // Escape in pause menu also continues the game
                             state.currentScreen = GameScreen::Playing;
-                        } else {
-                            // Quit Game
+                        }
+                    } else if (state.currentScreen == GameScreen::Help) {
+                        if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE ||
+                            evt.key.keysym.scancode == SDL_SCANCODE_SPACE ||
+                            evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
+                            // Return to main menu
                             state.currentScreen = GameScreen::Menu;
-                            state.menuSelection = 0; // Reset main menu
+                            state.menuSelection = 2; // Keep Help selected
                         }
                     }
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
-                        // Escape in pause menu also continues the game
-                        state.currentScreen = GameScreen::Playing;
-                    }
-                } else if (state.currentScreen == GameScreen::Help) {
-                    if (evt.key.keysym.scancode == SDL_SCANCODE_ESCAPE ||
-                        evt.key.keysym.scancode == SDL_SCANCODE_SPACE ||
-                        evt.key.keysym.scancode == SDL_SCANCODE_RETURN) {
-                        // Return to main menu
-                        state.currentScreen = GameScreen::Menu;
-                        state.menuSelection = 2; // Keep Help selected
-                    }
                 }
             }
         }
 
-        Uint32 now = SDL_GetTicks();
-        float dt = (now - lastTicks) / 1000.0f;
-        lastTicks = now;
-
-        const Uint8* keys = SDL_GetKeyboardState(nullptr);
-
-        if (state.currentScreen == GameScreen::Playing) {
-            if (!state.matchOver) {
-                // Update tanks based on play mode
-                bool player1CanControl, player2CanControl;
-                if (state.playMode == PlayMode::FreeForAll) {
-                    // In free-for-all, both players can control their tanks
-                    player1CanControl = true;
-                    player2CanControl = !state.isPlayer2Bot; // Bot still controlled by AI
-                } else {
-                    // Turn-based logic
-                    player1CanControl = state.currentPlayer == 1;
-                    player2CanControl = state.currentPlayer == 2 && !state.isPlayer2Bot;
-                }
+        Uint64 now = SDL_GetPerformanceCounter();
+        double frameSeconds = static_cast<double>(now - lastCounter) / static_cast<double>(counterFrequency);
+        lastCounter = now;
 
-                updateTank(state.player1, keys, dt, state.projectiles, player1CanControl, state);
-                updateTank(state.player2, keys, dt, state.projectiles, player2CanControl, state);
-                updateProjectiles(state, dt);
+        if (state.currentScreen != screenBeforeEvents) {
+            // Menu transitions can reset the match; never blend across them.
+            previousState = state;
+        }
 
-                // Update bot AI if it's bot's turn
-                if (state.isPlayer2Bot && state.currentPlayer == 2) {
-                    updateBotAI(state, dt);
+        const InputState input = readKeyboard();
+
+        int ticks = consumeFrameTime(timestep, frameSeconds);
+        const float tickDt = static_cast<float>(timestep.tickSeconds);
+        const Uint64 simStart = SDL_GetPerformanceCounter();
+        {
+            PROFILE_ZONE("simulation");
+            for (int tick = 0; tick < ticks; ++tick) {
+                previousState = state;
+                stepSimulation(state, input, tickDt);
+                terrainCanvas.dirty.include(state.terrain.tickDirty());
+            }
+        }
+        const Uint64 renderStart = SDL_GetPerformanceCounter();
+
+        {
+            PROFILE_ZONE("render");
+            drawBackground(renderer, sky, static_cast<float>(frameSeconds));
+            if (state.currentScreen == GameScreen::Playing || state.currentScreen == GameScreen::Paused) {
+                const GameState view = interpolateForRender(previousState, state, interpolationAlpha(timestep));
+                drawTerrain(renderer, terrainCanvas, view.terrain);
+                drawScenery(renderer, towerSprites, view.scenery);
+                drawNapalmPatches(geometry, view.napalmPatches);
+                drawProjectiles(geometry, view.projectiles);
+                drawExplosions(geometry, view.explosions);
+                flushGeometry(renderer, geometry);
+
+                // Tank smoke and force fields share a second batch drawn over the sprites
+                drawTank(renderer, geometry, view.player1, assets, true);
+                drawTank(renderer, geometry, view.player2, assets, false);
+
+                // Draw force fields
+                if (view.player1.forceFieldActive) {
+                    drawForceField(geometry, view.player1);
+                }
+                if (view.player2.forceFieldActive) {
+                    drawForceField(geometry, view.player2);
                 }
 
-                // Handle turn switching (only in turn-based mode)
-                if (state.playMode == PlayMode::TurnBased && state.waitingForTurnEnd) {
-                    state.turnEndTimer -= dt;
-                    // Check if all projectiles have finished (no active projectiles or napalm)
-                    bool allProjectilesFinished = state.projectiles.empty() ||
-                        std::all_of(state.projectiles.begin(), state.projectiles.end(),
-                            [](const Projectile& p) { return !p.alive; });
-                    bool allExplosionsFinished = state.explosions.empty() ||
-                        std::all_of(state.explosions.begin(), state.explosions.end(),
-                            [](const Explosion& e) { return e.timer <= 0.0f; });
-
-                    // Switch turns when timer expires OR all effects are finished
-                    if (state.turnEndTimer <= 0.0f || (allProjectilesFinished && allExplosionsFinished)) {
-                        state.currentPlayer = (state.currentPlayer == 1) ? 2 : 1;
-                        state.waitingForTurnEnd = false;
-                        state.shotFired = false;
-                        state.turnEndTimer = 0.0f;
-                    }
+                // Warn a human player whose shield could still stop what is coming
+                const ThreatReport threats = predictThreats(state);
+                if (!state.player1Bot.enabled && view.player1.forceFieldAvailable && !view.player1.forceFieldActive) {
+                    drawIncomingThreat(geometry, view.player1, threats.against(state.player1));
                 }
-            } else {
-                state.resetTimer -= dt;
-                if (state.resetTimer <= 0.0f) {
-                    state.currentScreen = GameScreen::Menu; // Return to menu after match
+                if (!state.player2Bot.enabled && view.player2.forceFieldAvailable && !view.player2.forceFieldActive) {
+                    drawIncomingThreat(geometry, view.player2, threats.against(state.player2));
                 }
+                flushGeometry(renderer, geometry);
             }
-        }
-
-        updateExplosions(state.explosions, dt);
-        updateNapalmPatches(state, dt);
-        applyGravityToTank(state.player1, state.terrainHeights, dt);
-        applyGravityToTank(state.player2, state.terrainHeights, dt);
+            drawUiLayer(renderer, uiLayer, state);
 
-        // Apply gravity to towers
-        for (auto& scenery : state.scenery) {
-            applyGravityToScenery(scenery, state.terrainHeights, dt);
-        }
-        if (state.player1.exploding) {
-            state.player1.explosionTimer -= dt;
-            if (state.player1.explosionTimer <= 0.0f) {
-                state.player1.exploding = false;
+            if (perf.visible && state.currentScreen == GameScreen::Playing) {
+                drawPerfOverlay(renderer, geometry, perf, state);
             }
         }
-        if (state.player2.exploding) {
-            state.player2.explosionTimer -= dt;
-            if (state.player2.explosionTimer <= 0.0f) {
-                state.player2.exploding = false;
-            }
-        }
-
-        if (state.currentScreen == GameScreen::Menu) {
-            drawMenu(renderer, state);
-        } else if (state.currentScreen == GameScreen::DifficultySelect) {
-            drawDifficultyMenu(renderer, state);
-        } else if (state.currentScreen == GameScreen::ModeSelect) {
-            drawModeMenu(renderer, state);
-        } else if (state.currentScreen == GameScreen::Help) {
-            drawHelpMenu(renderer, state);
-        } else if (state.currentScreen == GameScreen::Playing || state.currentScreen == GameScreen::Paused) {
-            drawBackground(renderer);
-            drawTerrain(renderer, state.terrainHeights, state.terrainSubstrate);
-            drawScenery(renderer, state.scenery);
-            drawNapalmPatches(renderer, state.napalmPatches);
-            drawProjectiles(renderer, state.projectiles);
-            drawExplosions(renderer, state.explosions);
-            drawTank(renderer, state.player1, assets, true);
-            drawTank(renderer, state.player2, assets, false);
-
-            // Draw force fields
-            if (state.player1.forceFieldActive) {
-                drawForceField(renderer, state.player1);
-            }
-            if (state.player2.forceFieldActive) {
-                drawForceField(renderer, state.player2);
-            }
-
-            drawUI(renderer, state);
-
-            if (state.matchOver) {
-                drawBanner(renderer, state.winner);
-            }
-
-            // Draw pause menu overlay if paused
-            if (state.currentScreen == GameScreen::Paused) {
-                drawPauseMenu(renderer, state);
-            }
+        const Uint64 renderEnd = SDL_GetPerformanceCounter();
+        const auto counterMs = [counterFrequency](Uint64 ticks) {
+            return static_cast<float>(1000.0 * static_cast<double>(ticks) / static_cast<double>(counterFrequency));
+        };
+        recordPerfFrame(perf, static_cast<float>(frameSeconds * 1000.0), counterMs(renderStart - simStart),
+                        counterMs(renderEnd - renderStart));
+
+        {
+            PROFILE_ZONE("present");
+            SDL_RenderPresent(renderer);
         }
+    }
 
-        SDL_RenderPresent(renderer);
+    if (!tracePath.empty() && !writeChromeTrace(tracePath)) {
+        SDL_Log("Failed to write trace to %s", tracePath.c_str());
     }
 
+    destroyUiLayer(uiLayer);
+    destroyTowerSprites(towerSprites);
+    destroyTerrainCanvas(terrainCanvas);
+    destroySkyBackground(sky);
+    destroyGlyphAtlas();
     destroyAssets(assets);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -0,0 +1,20 @@
+// src/render/render_stats.h
+#pragma once
+
+namespace tankduel {
+
+// Submissions of the current frame, shown by the perf overlay. Batched and
+// cached paths count their SDL calls; a cache redraw counts once however many
+// primitives it takes.
+struct RenderStats {
+    int drawCalls{0};
+    int cacheRedraws{0};
+    int textureUploads{0};
+};
+
+inline RenderStats& renderStats() {
+    static RenderStats stats;
+    return stats;
+}
+
+} // namespace tankduel
@@ -0,0 +1,148 @@
+// src/render/terrain_canvas.cpp
+#include "terrain_canvas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "core/constants.h"
+#include "core/profiler.h"
+#include "render_stats.h"
+
+namespace tankduel {
+
+namespace {
+
+// Striations reach 4 columns right of their source column and 2 left; the rim
+// light reads both neighbours.
+constexpr int TERRAIN_REACH_LEFT = 2;
+constexpr int TERRAIN_REACH_RIGHT = 4;
+
+// Composites color over one canvas pixel, clipped to the columns being redrawn
+void blendCanvasPixel(TerrainCanvas& canvas, int x, int y, SDL_Color color, const ColumnRange& clip) {
+    if (x < clip.first || x > clip.last || y < 0 || y >= LOGICAL_HEIGHT) return;
+    Uint32& dst = canvas.pixels[static_cast<size_t>(y) * LOGICAL_WIDTH + x];
+    const float srcA = color.a / 255.0f;
+    const float dstA = static_cast<float>(dst >> 24) / 255.0f;
+    const float outA = srcA + dstA * (1.0f - srcA);
+    if (outA <= 0.0f) {
+        dst = 0u;
+        return;
+    }
+    auto channel = [&](Uint8 src, int shift) {
+        float under = static_cast<float>((dst >> shift) & 0xFFu);
+        return static_cast<Uint32>(std::lround((src * srcA + under * dstA * (1.0f - srcA)) / outA));
+    };
+    dst = (static_cast<Uint32>(std::lround(outA * 255.0f)) << 24) | (channel(color.r, 16) << 16) |
+          (channel(color.g, 8) << 8) | channel(color.b, 0);
+}
+
+// Bresenham with both endpoints, as SDL_RenderDrawLine plots them
+void blendCanvasLine(TerrainCanvas& canvas, int x0, int y0, int x1, int y1, SDL_Color color, const ColumnRange& clip) {
+    const int dx = std::abs(x1 - x0);
+    const int dy = -std::abs(y1 - y0);
+    const int sx = x0 < x1 ? 1 : -1;
+    const int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    while (true) {
+        blendCanvasPixel(canvas, x0, y0, color, clip);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void rasterizeTerrain(TerrainCanvas& canvas, const std::vector<int>& surface, const std::vector<int>& substrate, const ColumnRange& clip) {
+    PROFILE_FUNCTION();
+    const SDL_Color bedrock{ 72, 76, 88, 255 };
+    const SDL_Color base{ 104, 108, 120, 255 };
+    const SDL_Color highlight{ 224, 226, 232, 210 };
+    const SDL_Color midTone{ 150, 154, 164, 150 };
+    const SDL_Color rimLight{ 242, 244, 248, 160 };
+    const SDL_Color striation{ 94, 98, 112, 180 };
+
+    for (int x = clip.first; x <= clip.last; ++x) {
+        int top = surface[x];
+        int sub = substrate.empty() ? std::min(LOGICAL_HEIGHT - 12, top + 14) : std::max(surface[x] + 6, substrate[x]);
+        for (int y = 0; y < LOGICAL_HEIGHT; ++y) {
+            SDL_Color c = y > sub ? bedrock : base;
+            canvas.pixels[static_cast<size_t>(y) * LOGICAL_WIDTH + x] =
+                y < top ? 0u : (0xFF000000u | (c.r << 16) | (c.g << 8) | c.b);
+        }
+    }
+
+    // Source columns whose strokes can land inside the clip
+    const int strokeFirst = std::max(0, clip.first - TERRAIN_REACH_RIGHT);
+    const int strokeLast = std::min(LOGICAL_WIDTH - 1, clip.last + TERRAIN_REACH_LEFT);
+    for (int x = (strokeFirst + 5) / 6 * 6; x <= strokeLast; x += 6) {
+        int top = surface[x];
+        blendCanvasLine(canvas, x - 2, top + 3, x + 4, top + 8, striation, clip);
+    }
+    for (int x = (strokeFirst + 4) / 5 * 5; x <= strokeLast; x += 5) {
+        int top = surface[x];
+        blendCanvasLine(canvas, x, top + 2, x + 1, top + 6, midTone, clip);
+    }
+
+    for (int x = clip.first; x <= clip.last; ++x) {
+        int top = surface[x];
+        blendCanvasPixel(canvas, x, top, highlight, clip);
+        if (x % 7 == 0) {
+            blendCanvasPixel(canvas, x, top - 1, highlight, clip);
+        }
+    }
+
+    for (int x = std::max(1, clip.first); x <= std::min(LOGICAL_WIDTH - 2, clip.last); ++x) {
+        int current = surface[x];
+        int prev = surface[x - 1];
+        int next = surface[x + 1];
+        if (current <= prev && current <= next) {
+            blendCanvasPixel(canvas, x, current - 1, rimLight, clip);
+        }
+    }
+}
+
+} // namespace
+
+bool createTerrainCanvas(SDL_Renderer* renderer, TerrainCanvas& canvas) {
+    canvas.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                       LOGICAL_WIDTH, LOGICAL_HEIGHT);
+    if (!canvas.texture) return false;
+    SDL_SetTextureBlendMode(canvas.texture, SDL_BLENDMODE_BLEND);
+    canvas.pixels.assign(static_cast<size_t>(LOGICAL_WIDTH) * LOGICAL_HEIGHT, 0u);
+    canvas.dirty = ColumnRange{ 0, LOGICAL_WIDTH - 1 };
+    return true;
+}
+
+void destroyTerrainCanvas(TerrainCanvas& canvas) {
+    if (canvas.texture) {
+        SDL_DestroyTexture(canvas.texture);
+        canvas.texture = nullptr;
+    }
+}
+
+void drawTerrain(SDL_Renderer* renderer, TerrainCanvas& canvas, const Terrain& terrain) {
+    PROFILE_FUNCTION();
+    // Edits made outside a tick (a new match) have not reached tickDirty yet
+    canvas.dirty.include(terrain.pendingDirty());
+    if (!canvas.dirty.empty() && !terrain.heights.empty()) {
+        ColumnRange clip{ std::max(0, canvas.dirty.first - TERRAIN_REACH_LEFT),
+                          std::min(LOGICAL_WIDTH - 1, canvas.dirty.last + TERRAIN_REACH_RIGHT) };
+        rasterizeTerrain(canvas, terrain.heights, terrain.substrate, clip);
+        SDL_Rect region{ clip.first, 0, clip.last - clip.first + 1, LOGICAL_HEIGHT };
+        ++renderStats().textureUploads;
+        SDL_UpdateTexture(canvas.texture, &region, &canvas.pixels[static_cast<size_t>(clip.first)],
+                          LOGICAL_WIDTH * static_cast<int>(sizeof(Uint32)));
+        canvas.dirty = ColumnRange{};
+    }
+    ++renderStats().drawCalls;
+    SDL_RenderCopy(renderer, canvas.texture, nullptr, nullptr);
+}
+
+} // namespace tankduel
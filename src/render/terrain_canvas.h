@@ -0,0 +1,25 @@
+// src/render/terrain_canvas.h
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+#include "core/terrain_state.h"
+
+namespace tankduel {
+
+// Terrain is rasterized on the CPU into a streaming texture and only the
+// columns edited since the last upload are redrawn.
+struct TerrainCanvas {
+    SDL_Texture* texture{};
+    std::vector<Uint32> pixels{};  // ARGB8888, LOGICAL_WIDTH x LOGICAL_HEIGHT
+    ColumnRange dirty{};
+};
+
+bool createTerrainCanvas(SDL_Renderer* renderer, TerrainCanvas& canvas);
+void destroyTerrainCanvas(TerrainCanvas& canvas);
+
+// Redraws the dirty columns (plus any edits still pending on `terrain`),
+// uploads them and copies the canvas to the screen.
+void drawTerrain(SDL_Renderer* renderer, TerrainCanvas& canvas, const Terrain& terrain);
+
+} // namespace tankduel
@@ -0,0 +1,251 @@
+// src/render/text.cpp
+#include "text.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <vector>
+
+#include "core/profiler.h"
+#include "render_stats.h"
+
+namespace tankduel {
+
+namespace {
+
+using GlyphRows = std::array<uint8_t, GLYPH_HEIGHT>;
+
+constexpr GlyphRows GLYPH_SPACE{ 0,0,0,0,0,0,0 };
+constexpr GlyphRows GLYPH_A{ 0b011110, 0b100001, 0b100001, 0b111111, 0b100001, 0b100001, 0b100001 };
+constexpr GlyphRows GLYPH_B{ 0b111110, 0b100001, 0b100001, 0b111110, 0b100001, 0b100001, 0b111110 };
+constexpr GlyphRows GLYPH_C{ 0b011110, 0b100001, 0b100000, 0b100000, 0b100000, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_E{ 0b111111, 0b100000, 0b100000, 0b111110, 0b100000, 0b100000, 0b111111 };
+constexpr GlyphRows GLYPH_G{ 0b011110, 0b100001, 0b100000, 0b101111, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_M{ 0b100001, 0b110011, 0b101101, 0b100001, 0b100001, 0b100001, 0b100001 };
+constexpr GlyphRows GLYPH_O{ 0b011110, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_Q{ 0b011110, 0b100001, 0b100001, 0b100101, 0b100011, 0b100001, 0b011111 };
+constexpr GlyphRows GLYPH_V{ 0b100001, 0b100001, 0b100001, 0b100001, 0b010010, 0b010010, 0b001100 };
+constexpr GlyphRows GLYPH_R{ 0b111110, 0b100001, 0b100001, 0b111110, 0b101000, 0b100100, 0b100011 };
+constexpr GlyphRows GLYPH_T{ 0b111111, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100 };
+constexpr GlyphRows GLYPH_P{ 0b111110, 0b100001, 0b100001, 0b111110, 0b100000, 0b100000, 0b100000 };
+constexpr GlyphRows GLYPH_L{ 0b100000, 0b100000, 0b100000, 0b100000, 0b100000, 0b100000, 0b111111 };
+constexpr GlyphRows GLYPH_U{ 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_Y{ 0b100001, 0b010010, 0b010010, 0b001100, 0b001100, 0b001100, 0b001100 };
+constexpr GlyphRows GLYPH_W{ 0b100001, 0b100001, 0b100001, 0b100101, 0b101101, 0b110011, 0b100001 };
+constexpr GlyphRows GLYPH_X{ 0b100001, 0b010010, 0b001100, 0b001100, 0b010010, 0b100001, 0b100001 };
+constexpr GlyphRows GLYPH_Z{ 0b111111, 0b000010, 0b000100, 0b001000, 0b010000, 0b100000, 0b111111 };
+constexpr GlyphRows GLYPH_I{ 0b111111, 0b001100, 0b001100, 0b001100, 0b001100, 0b001100, 0b111111 };
+constexpr GlyphRows GLYPH_J{ 0b000001, 0b000001, 0b000001, 0b000001, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_N{ 0b100001, 0b110001, 0b101001, 0b100101, 0b100011, 0b100001, 0b100001 };
+constexpr GlyphRows GLYPH_S{ 0b011111, 0b100000, 0b100000, 0b011110, 0b000001, 0b000001, 0b111110 };
+constexpr GlyphRows GLYPH_H{ 0b100001, 0b100001, 0b100001, 0b111111, 0b100001, 0b100001, 0b100001 };
+constexpr GlyphRows GLYPH_F{ 0b111111, 0b100000, 0b100000, 0b111110, 0b100000, 0b100000, 0b100000 };
+constexpr GlyphRows GLYPH_D{ 0b111110, 0b100001, 0b100001, 0b100001, 0b100001, 0b100001, 0b111110 };
+constexpr GlyphRows GLYPH_K{ 0b100001, 0b100010, 0b100100, 0b111000, 0b100100, 0b100010, 0b100001 };
+constexpr GlyphRows GLYPH_APOSTROPHE{ 0b001100, 0b001100, 0b011000, 0b000000, 0b000000, 0b000000, 0b000000 };
+constexpr GlyphRows GLYPH_HYPHEN{ 0b000000, 0b000000, 0b000000, 0b111110, 0b000000, 0b000000, 0b000000 };
+constexpr GlyphRows GLYPH_ONE{ 0b001100, 0b011100, 0b001100, 0b001100, 0b001100, 0b001100, 0b111111 };
+constexpr GlyphRows GLYPH_TWO{ 0b011110, 0b100001, 0b000001, 0b000110, 0b001100, 0b011000, 0b111111 };
+constexpr GlyphRows GLYPH_ZERO{ 0b011110, 0b100001, 0b100011, 0b100101, 0b101001, 0b110001, 0b011110 };
+constexpr GlyphRows GLYPH_THREE{ 0b011110, 0b100001, 0b000001, 0b001110, 0b000001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_FOUR{ 0b000110, 0b001010, 0b010010, 0b100010, 0b111111, 0b000010, 0b000010 };
+constexpr GlyphRows GLYPH_FIVE{ 0b111111, 0b100000, 0b111110, 0b000001, 0b000001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_SIX{ 0b011110, 0b100000, 0b100000, 0b111110, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_SEVEN{ 0b111111, 0b000001, 0b000010, 0b000100, 0b001000, 0b001000, 0b001000 };
+constexpr GlyphRows GLYPH_EIGHT{ 0b011110, 0b100001, 0b100001, 0b011110, 0b100001, 0b100001, 0b011110 };
+constexpr GlyphRows GLYPH_NINE{ 0b011110, 0b100001, 0b100001, 0b011111, 0b000001, 0b000001, 0b011110 };
+constexpr GlyphRows GLYPH_PERIOD{ 0b000000, 0b000000, 0b000000, 0b000000, 0b000000, 0b001100, 0b001100 };
+constexpr GlyphRows GLYPH_COLON{ 0b000000, 0b001100, 0b001100, 0b000000, 0b001100, 0b001100, 0b000000 };
+constexpr GlyphRows GLYPH_SLASH{ 0b000001, 0b000010, 0b000100, 0b001000, 0b010000, 0b100000, 0b000000 };
+
+const GlyphRows* glyphFor(char c) {
+    switch (c) {
+        case 'A': return &GLYPH_A;
+        case 'B': return &GLYPH_B;
+        case 'C': return &GLYPH_C;
+        case 'D': return &GLYPH_D;
+        case 'E': return &GLYPH_E;
+        case 'F': return &GLYPH_F;
+        case 'G': return &GLYPH_G;
+        case 'H': return &GLYPH_H;
+        case 'I': return &GLYPH_I;
+        case 'J': return &GLYPH_J;
+        case 'K': return &GLYPH_K;
+        case 'L': return &GLYPH_L;
+        case 'M': return &GLYPH_M;
+        case 'N': return &GLYPH_N;
+        case 'O': return &GLYPH_O;
+        case 'P': return &GLYPH_P;
+        case 'Q': return &GLYPH_Q;
+        case 'R': return &GLYPH_R;
+        case 'S': return &GLYPH_S;
+        case 'T': return &GLYPH_T;
+        case 'U': return &GLYPH_U;
+        case 'V': return &GLYPH_V;
+        case 'W': return &GLYPH_W;
+        case 'X': return &GLYPH_X;
+        case 'Y': return &GLYPH_Y;
+        case 'Z': return &GLYPH_Z;
+        case '1': return &GLYPH_ONE;
+        case '2': return &GLYPH_TWO;
+        case '0': return &GLYPH_ZERO;
+        case '3': return &GLYPH_THREE;
+        case '4': return &GLYPH_FOUR;
+        case '5': return &GLYPH_FIVE;
+        case '6': return &GLYPH_SIX;
+        case '7': return &GLYPH_SEVEN;
+        case '8': return &GLYPH_EIGHT;
+        case '9': return &GLYPH_NINE;
+        case '.': return &GLYPH_PERIOD;
+        case ':': return &GLYPH_COLON;
+        case '/': return &GLYPH_SLASH;
+        case ' ': return &GLYPH_SPACE;
+        case '\'': return &GLYPH_APOSTROPHE;
+        case '-': return &GLYPH_HYPHEN;
+        default:  return nullptr;
+    }
+}
+
+// Atlas slot for each ASCII code (matched case-insensitively); -1 means the
+// character is drawn as a word gap. Shared by drawText and measureText.
+struct GlyphTable {
+    std::array<int8_t, 128> slots{};
+    std::vector<const GlyphRows*> glyphs{};
+};
+
+const GlyphTable& glyphTable() {
+    static const GlyphTable table = [] {
+        GlyphTable built;
+        built.slots.fill(-1);
+        for (int c = 0; c < 128; ++c) {
+            if (c == ' ') continue;
+            const GlyphRows* glyph = glyphFor(static_cast<char>(std::toupper(c)));
+            if (!glyph) continue;
+            auto found = std::find(built.glyphs.begin(), built.glyphs.end(), glyph);
+            if (found == built.glyphs.end()) {
+                built.glyphs.push_back(glyph);
+                found = built.glyphs.end() - 1;
+            }
+            built.slots[c] = static_cast<int8_t>(found - built.glyphs.begin());
+        }
+        return built;
+    }();
+    return table;
+}
+
+int glyphSlot(char c) {
+    unsigned char code = static_cast<unsigned char>(c);
+    return code < 128 ? glyphTable().slots[code] : -1;
+}
+
+int glyphAdvance(int slot, int pixelSize) {
+    int glyphSpacing = pixelSize + 2;  // Increased from pixelSize + 1
+    int wordSpacing = pixelSize * 3;   // Increased from pixelSize * 2
+    return slot < 0 ? wordSpacing : GLYPH_WIDTH * pixelSize + glyphSpacing;
+}
+
+// Every glyph at one texel per font pixel, white on transparent; text is
+// tinted through vertex colours and scaled up with nearest sampling, which
+// matches the old one-rect-per-pixel output for every pixelSize.
+struct GlyphAtlas {
+    SDL_Texture* texture{};
+    int width{0};
+};
+
+constexpr int GLYPH_ATLAS_STRIDE = GLYPH_WIDTH + 1;
+
+GlyphAtlas& glyphAtlas() {
+    static GlyphAtlas atlas;
+    return atlas;
+}
+
+} // namespace
+
+bool createGlyphAtlas(SDL_Renderer* renderer) {
+    const GlyphTable& table = glyphTable();
+    GlyphAtlas& atlas = glyphAtlas();
+    atlas.width = static_cast<int>(table.glyphs.size()) * GLYPH_ATLAS_STRIDE;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, atlas.width, GLYPH_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) return false;
+
+    SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 0));
+    const Uint32 white = SDL_MapRGBA(surface->format, 255, 255, 255, 255);
+    for (size_t slot = 0; slot < table.glyphs.size(); ++slot) {
+        const GlyphRows& glyph = *table.glyphs[slot];
+        for (int row = 0; row < GLYPH_HEIGHT; ++row) {
+            for (int col = 0; col < GLYPH_WIDTH; ++col) {
+                if (glyph[row] & (1 << (GLYPH_WIDTH - 1 - col))) {
+                    SDL_Rect texel{ static_cast<int>(slot) * GLYPH_ATLAS_STRIDE + col, row, 1, 1 };
+                    SDL_FillRect(surface, &texel, white);
+                }
+            }
+        }
+    }
+
+    atlas.texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!atlas.texture) return false;
+    SDL_SetTextureBlendMode(atlas.texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(atlas.texture, SDL_ScaleModeNearest);
+    return true;
+}
+
+void destroyGlyphAtlas() {
+    GlyphAtlas& atlas = glyphAtlas();
+    if (atlas.texture) {
+        SDL_DestroyTexture(atlas.texture);
+        atlas.texture = nullptr;
+    }
+}
+
+// One textured quad per glyph, submitted as a single geometry batch
+int drawText(SDL_Renderer* renderer, int x, int y, const std::string& text, SDL_Color color, int pixelSize) {
+    PROFILE_FUNCTION();
+    static std::vector<SDL_Vertex> vertices;
+    static std::vector<int> indices;
+    vertices.clear();
+    indices.clear();
+
+    const GlyphAtlas& atlas = glyphAtlas();
+    const float texel = 1.0f / static_cast<float>(std::max(1, atlas.width));
+    const float w = static_cast<float>(GLYPH_WIDTH * pixelSize);
+    const float h = static_cast<float>(GLYPH_HEIGHT * pixelSize);
+    int cursor = x;
+    for (char c : text) {
+        int slot = glyphSlot(c);
+        if (slot >= 0) {
+            const float left = static_cast<float>(cursor);
+            const float top = static_cast<float>(y);
+            const float u0 = static_cast<float>(slot * GLYPH_ATLAS_STRIDE) * texel;
+            const float u1 = u0 + static_cast<float>(GLYPH_WIDTH) * texel;
+            const int base = static_cast<int>(vertices.size());
+            vertices.push_back(SDL_Vertex{ { left, top }, color, { u0, 0.0f } });
+            vertices.push_back(SDL_Vertex{ { left + w, top }, color, { u1, 0.0f } });
+            vertices.push_back(SDL_Vertex{ { left + w, top + h }, color, { u1, 1.0f } });
+            vertices.push_back(SDL_Vertex{ { left, top + h }, color, { u0, 1.0f } });
+            for (int corner : { 0, 1, 2, 0, 2, 3 }) {
+                indices.push_back(base + corner);
+            }
+        }
+        cursor += glyphAdvance(slot, pixelSize);
+    }
+
+    if (!vertices.empty() && atlas.texture) {
+        ++renderStats().drawCalls;
+        SDL_RenderGeometry(renderer, atlas.texture, vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(indices.size()));
+    }
+    return cursor - x;
+}
+
+int measureText(const std::string& text, int pixelSize) {
+    int width = 0;
+    for (char c : text) {
+        width += glyphAdvance(glyphSlot(c), pixelSize);
+    }
+    if (width > 0) width -= pixelSize + 2;
+    return width;
+}
+
+} // namespace tankduel
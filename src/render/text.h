@@ -0,0 +1,21 @@
+// src/render/text.h
+#pragma once
+#include <SDL.h>
+#include <string>
+
+namespace tankduel {
+
+constexpr int GLYPH_WIDTH = 6;
+constexpr int GLYPH_HEIGHT = 7;
+constexpr int DEFAULT_GLYPH_PIXEL = 3;
+
+// The glyph atlas must exist before drawText and is lost with the renderer.
+bool createGlyphAtlas(SDL_Renderer* renderer);
+void destroyGlyphAtlas();
+
+// Draws upper-case pixel text at integer scale; returns the advance in pixels.
+int drawText(SDL_Renderer* renderer, int x, int y, const std::string& text, SDL_Color color,
+             int pixelSize = DEFAULT_GLYPH_PIXEL);
+int measureText(const std::string& text, int pixelSize = DEFAULT_GLYPH_PIXEL);
+
+} // namespace tankduel